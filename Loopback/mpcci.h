@@ -0,0 +1,223 @@
+// $Id$
+//==============================================================================
+//!
+//! \file mpcci.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Loopback stand-in for the subset of the MpCCI client API
+//! used by the IFEM adapter.
+//!
+//! \details The loopback server runs in-process. It drives the registered
+//! MPCCI_DRIVER callbacks with synthetic or recorded fluid loads, and
+//! reports the time spent in the callbacks when the job quits.
+//! It is configured through the following environment variables:
+//! - MPCCI_LOOPBACK_PART: Comma-separated names of coupled parts
+//!   (default "couple-flap")
+//! - MPCCI_LOOPBACK_QUANT: "pressure" (default) or "force"
+//! - MPCCI_LOOPBACK_AMPLITUDE: Load amplitude (default 1000)
+//! - MPCCI_LOOPBACK_FREQUENCY: Load frequency in Hz (default 1)
+//! - MPCCI_LOOPBACK_STEPS: Number of transfers before stopping (default 100)
+//! - MPCCI_LOOPBACK_DATA: Binary replay file with recorded face pressures
+//! - MPCCI_LOOPBACK_ADAPTIVE: 1 to accept the time step size proposed
+//!   by the code, otherwise the time step size is echoed back
+//!
+//==============================================================================
+
+#ifndef MPCCI_LOOPBACK_H_
+#define MPCCI_LOOPBACK_H_
+
+#include "mpcci_quantities.h"
+
+#define MPCCI_CCM_VERSION 1 //!< Driver structure version
+
+#define MPCCI_CSYS_C3D 3 //!< 3D cartesian coordinate system
+
+#define MPCCI_ETYP_LINE2 2 //!< Linear line element
+#define MPCCI_ETYP_LINE3 3 //!< Quadratic line element
+#define MPCCI_ETYP_QUAD4 4 //!< Bilinear quadrilateral element
+#define MPCCI_ETYP_QUAD9 9 //!< Biquadratic quadrilateral element
+
+#define MPCCI_CONV_STATE_INVALID   -1 //!< No valid state
+#define MPCCI_CONV_STATE_CONTINUE   0 //!< Continue the coupled simulation
+#define MPCCI_CONV_STATE_CONVERGED  1 //!< Coupling iterations converged
+#define MPCCI_CONV_STATE_DIVERGED   2 //!< Coupling iterations diverged
+#define MPCCI_CONV_STATE_STOP       3 //!< Stop the coupled simulation
+
+#define MPCCI_QSM_DIRECT 0 //!< Direct storage method
+
+#define MPCCI_QFLAG_LOC_VERT 0x1 //!< Quantity located at vertices
+#define MPCCI_QFLAG_LOC_CELL 0x2 //!< Quantity located at cells
+#define MPCCI_QFLAG_LOC_MASK 0x3 //!< Mask for quantity location
+
+#define MPCCI_CFLAG_TYPE_FEA  0x1 //!< Code is a finite element analysis
+#define MPCCI_CFLAG_GRID_CURR 0x2 //!< Code sends the current grid
+
+#define MPCCI_MSG_LEVEL_ERROR   0 //!< Print errors only
+#define MPCCI_MSG_LEVEL_WARNING 1 //!< Print warnings and errors
+#define MPCCI_MSG_LEVEL_INFO    2 //!< Print information
+#define MPCCI_MSG_LEVEL_DEBUG   3 //!< Print everything
+
+#define MPCCI_PART_TYPE_FACE 2 //!< Part is a face
+
+//! \brief Server connection, collecting the coupled mesh.
+struct MPCCI_SERVER;
+
+//! \brief Coupled mesh part.
+struct MPCCI_PART {
+  const char* name; //!< Name of part
+  int meshid; //!< Mesh id
+  int partid; //!< Part id
+  int type; //!< Part type
+  int nnodes; //!< Number of nodes
+  int nelems; //!< Number of elements
+};
+
+//! \brief Coupled quantity.
+struct MPCCI_QUANT {
+  int qid; //!< Quantity id
+  int smethod; //!< Storage method
+  unsigned flags; //!< Quantity flags
+  int dim; //!< Number of components
+  int coord; //!< Nonzero for coordinate quantities
+};
+
+//! \brief Global coupled quantity.
+struct MPCCI_GLOB {
+  int qid; //!< Quantity id
+};
+
+//! \brief Time step information.
+struct MPCCI_TINFO {
+  int mpcci_state; //!< Nonzero if coupling is initialized
+  int mpcci_used; //!< Nonzero if coupling is active
+  double time; //!< Current time
+  double dt; //!< Time step size
+  int iter; //!< Iteration number
+  int conv_code; //!< Convergence state of the code
+  int conv_job; //!< Convergence state of the coupled job
+};
+
+//! \brief Code information.
+struct MPCCI_CINFO {
+  const char* codename; //!< Name of code
+  unsigned flags; //!< Code flags
+  int nclients; //!< Number of clients
+  int nprocs; //!< Number of processes
+  double time; //!< Initial time
+  MPCCI_TINFO* tinfo; //!< Time step information
+};
+
+//! \brief Callback table registered by the code.
+struct MPCCI_DRIVER {
+  unsigned this_size; //!< Size of structure
+  int this_version; //!< Structure version
+  unsigned tact_required; //!< Required actions
+  const char* part_description[7]; //!< Part type names
+  unsigned realsize; //!< Size of real values
+
+  void (*afterCloseSetup)(); //!< Not used
+  void (*beforeGetAndSend)(); //!< Not used
+  void (*afterGetAndSend)(); //!< Not used
+  void (*beforeRecvAndPut)(); //!< Not used
+  void (*afterRecvAndPut)(); //!< Not used
+  void (*partSelect)(); //!< Not used
+  int (*partUpdate)(MPCCI_PART*, MPCCI_QUANT*); //!< Update part info
+  void (*appendParts)(); //!< Not used
+  void (*getPartRemeshState)(); //!< Not used
+  int (*definePart)(MPCCI_SERVER*, MPCCI_PART*); //!< Define coupled mesh
+  void (*partInfo)(); //!< Not used
+  void (*getNodes)(); //!< Not used
+  void (*getElems)(); //!< Not used
+  void (*moveNodes)(); //!< Not used
+
+  //! \brief Function sending values for a part.
+  using GetValues = int (*)(const MPCCI_PART*, const MPCCI_QUANT*, void*);
+  //! \brief Function receiving values for a part.
+  using PutValues = void (*)(const MPCCI_PART*, const MPCCI_QUANT*, void*);
+
+  GetValues getPointValues; //!< Not used
+  GetValues getLineNodeValues; //!< Not used
+  GetValues getLineElemValues; //!< Not used
+  GetValues getFaceNodeValues; //!< Send face node values
+  GetValues getFaceElemValues; //!< Send face element values
+  GetValues getVoluNodeValues; //!< Not used
+  GetValues getVoluElemValues; //!< Not used
+  int (*getGlobalValues)(const MPCCI_GLOB*, void*); //!< Send global values
+  PutValues putPointValues; //!< Not used
+  PutValues putLineNodeValues; //!< Not used
+  PutValues putLineElemValues; //!< Not used
+  PutValues putFaceNodeValues; //!< Receive face node values
+  PutValues putFaceElemValues; //!< Receive face element values
+  PutValues putVoluNodeValues; //!< Not used
+  PutValues putVoluElemValues; //!< Not used
+  void (*putGlobalValues)(const MPCCI_GLOB*, void*); //!< Receive global values
+};
+
+//! \brief Coupled job.
+struct MPCCI_JOB;
+
+#define MPCCI_PART_NAME(p)   ((p)->name)
+#define MPCCI_PART_MESHID(p) ((p)->meshid)
+#define MPCCI_PART_PARTID(p) ((p)->partid)
+#define MPCCI_PART_NNODES(p) ((p)->nnodes)
+#define MPCCI_PART_NELEMS(p) ((p)->nelems)
+#define MPCCI_PART_IS_FACE(p) ((p)->type == MPCCI_PART_TYPE_FACE)
+
+#define MPCCI_QUANT_QID(q)      ((q)->qid)
+#define MPCCI_QUANT_SMETHOD(q)  ((q)->smethod)
+#define MPCCI_QUANT_IS_COORD(q) ((q)->coord != 0)
+
+//! \brief Prints a formatted message at a given level.
+void umpcci_msg_print(int level, const char* fmt, ...);
+
+#define MPCCI_MSG_INFO0(f)      umpcci_msg_print(MPCCI_MSG_LEVEL_INFO, f)
+#define MPCCI_MSG_INFO1(f,a)    umpcci_msg_print(MPCCI_MSG_LEVEL_INFO, f, a)
+#define MPCCI_MSG_WARNING0(f)   umpcci_msg_print(MPCCI_MSG_LEVEL_WARNING, f)
+#define MPCCI_MSG_ASSERT(c) \
+  ((c) ? (void)0 : umpcci_msg_print(MPCCI_MSG_LEVEL_ERROR, \
+                                    "Assertion failed: %s\n", #c))
+
+//! \brief Function printing a message.
+typedef void (*MPCCI_PRINTER)(const char*, int);
+
+//! \brief Registers message printers and the exit function.
+void umpcci_msg_functs(MPCCI_PRINTER info, MPCCI_PRINTER warning,
+                       MPCCI_PRINTER error, MPCCI_PRINTER, MPCCI_PRINTER,
+                       MPCCI_PRINTER, void (*exitFunc)());
+//! \brief Sets the message prefix.
+void umpcci_msg_prefix(const char* prefix);
+//! \brief Sets the message level.
+void umpcci_msg_level(int level);
+
+//! \brief Initializes the time step information.
+void ampcci_tinfo_init(MPCCI_TINFO* tinfo, const char*);
+//! \brief Initializes the code information.
+void mpcci_cinfo_init(MPCCI_CINFO* cinfo, MPCCI_TINFO* tinfo);
+//! \brief Starts the coupled job.
+MPCCI_JOB* mpcci_init(const char*, MPCCI_CINFO* cinfo);
+//! \brief Registers the driver and defines the coupled parts.
+int ampcci_config(MPCCI_JOB** job, MPCCI_DRIVER* driver);
+//! \brief Performs a data exchange.
+//! \return 1 if data was exchanged, 0 if not, -1 on error
+int ampcci_transfer(MPCCI_JOB* job, MPCCI_TINFO* tinfo);
+//! \brief Sets the convergence state of the code.
+void umpcci_conv_cstate(int state);
+//! \brief Ends the coupled job.
+void mpcci_quit(MPCCI_JOB** job);
+
+//! \brief Defines a coupled part.
+int smpcci_defp(MPCCI_SERVER* server, int meshid, int partid, int csys,
+                int nnodes, int nelems, const char* name);
+//! \brief Defines the nodes of a coupled part.
+int smpcci_pnod(MPCCI_SERVER* server, int meshid, int partid, int csys,
+                int nnodes, const void* coords, unsigned realsize,
+                const int* ids, const void* angles);
+//! \brief Defines the elements of a coupled part.
+int smpcci_pels(MPCCI_SERVER* server, int meshid, int partid, int nelems,
+                unsigned type, const unsigned* types, const int* nodes,
+                const int* ids);
+
+#endif
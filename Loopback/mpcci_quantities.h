@@ -0,0 +1,25 @@
+// $Id$
+//==============================================================================
+//!
+//! \file mpcci_quantities.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Quantity identifiers for the loopback MpCCI stand-in.
+//!
+//==============================================================================
+
+#ifndef MPCCI_LOOPBACK_QUANTITIES_H_
+#define MPCCI_LOOPBACK_QUANTITIES_H_
+
+// Only the quantities used by the IFEM adapter are provided
+#define MPCCI_QID_NPOSITION     1 //!< Node positions
+#define MPCCI_QID_WALLFORCE     2 //!< Nodal wall forces
+#define MPCCI_QID_ABSPRESSURE   3 //!< Absolute face pressures
+#define MPCCI_QID_OVERPRESSURE  4 //!< Relative face pressures
+#define MPCCI_QID_PHYSICAL_TIME 5 //!< Physical time
+#define MPCCI_QID_TIMESTEP_SIZE 6 //!< Time step size
+
+#endif
@@ -0,0 +1,105 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MpCCIAccelerator.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Interface accelerators for implicit coupling iterations.
+//!
+//==============================================================================
+
+#ifndef MPCCI_ACCELERATOR_H_
+#define MPCCI_ACCELERATOR_H_
+
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace tinyxml2 { class XMLElement; }
+
+namespace MpCCI {
+
+/*!
+  \brief Accelerator for the fixed-point iterations of implicit coupling.
+  \details The interface values x are iterated as x = S(F(x)), where F is
+  the fluid solver and S the structure solver. Given the structure output
+  \f$\tilde{x}_k = S(F(x_k))\f$, the next interface values are computed
+  by constant or dynamic Aitken under-relaxation, or by the interface
+  quasi-Newton method with inverse Jacobian from a least-squares
+  model (IQN-ILS).
+*/
+
+class Accelerator
+{
+public:
+  //! \brief Acceleration methods.
+  enum class Method {
+    Constant, //!< Constant under-relaxation
+    Aitken,   //!< Dynamic Aitken under-relaxation
+    IQNILS    //!< Interface quasi-Newton, inverse least-squares
+  };
+
+  //! \brief Parses the accelerator settings from an XML element.
+  //! \details Recognized attributes are \a method (constant, aitken or
+  //! iqn-ils), \a omega (initial relaxation factor), \a tol (relative
+  //! residual tolerance), \a atol (absolute residual tolerance)
+  //! and \a reuse (number of previous steps to keep IQN-ILS data from).
+  void parse(const tinyxml2::XMLElement* elem);
+
+  //! \brief Starts a new time step.
+  //! \param x0 Interface values sent in the first coupling iteration
+  void beginStep(const std::vector<double>& x0);
+
+  //! \brief Computes the interface values for the next iteration.
+  //! \param xt Structure output for the current iteration
+  //! \param x Interface values for the next iteration
+  //! \return True if the interface residual has converged
+  bool update(const std::vector<double>& xt, std::vector<double>& x);
+
+  //! \brief Returns the norm of the last interface residual.
+  double residual() const { return resNorm; }
+  //! \brief Returns the relative norm of the last interface residual.
+  double relResidual() const { return relNorm; }
+  //! \brief Returns the relaxation factor of the last iteration.
+  double relaxation() const { return omega; }
+  //! \brief Returns the name of the acceleration method.
+  const char* name() const;
+
+  //! \brief Appends the state kept between time steps to a checkpoint buffer.
+  //! \details This is the relaxation factor and the IQN-ILS history.
+  void serialize(std::string& str) const;
+  //! \brief Restores the state kept between time steps from a checkpoint buffer.
+  //! \param str The checkpoint buffer
+  //! \param pos Position in \a str, advanced past the accelerator state
+  bool deSerialize(const std::string& str, size_t& pos);
+
+private:
+  //! \brief Computes the IQN-ILS update.
+  //! \return False if no usable columns are available
+  bool quasiNewton(const std::vector<double>& xt, std::vector<double>& x);
+
+  Method method = Method::Aitken; //!< Acceleration method
+  double omega0 = 0.5; //!< Initial relaxation factor
+  double tol = 1.0e-6; //!< Relative residual tolerance
+  double atol = 1.0e-12; //!< Absolute residual tolerance
+  int reuse = 0; //!< Number of previous steps to reuse IQN-ILS data from
+
+  int iter = 0; //!< Iteration counter within the current step
+  double omega = 0.5; //!< Current relaxation factor
+  double resNorm = 0.0; //!< Norm of last residual
+  double relNorm = 0.0; //!< Relative norm of last residual
+  std::vector<double> xk; //!< Interface values of current iteration
+  std::vector<double> rk; //!< Residual of previous iteration
+  std::vector<double> xtk; //!< Structure output of previous iteration
+
+  std::deque<std::vector<double>> V; //!< Residual differences, newest first
+  std::deque<std::vector<double>> W; //!< Output differences, newest first
+  std::deque<int> stepCols; //!< Number of columns added in each time step
+};
+
+}
+
+#endif
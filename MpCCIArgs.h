@@ -16,7 +16,10 @@
 
 #include "SIMargsBase.h"
 
-class tinyxml2 { XMLElement; }
+#include <string>
+#include <vector>
+
+namespace tinyxml2 { class XMLElement; }
 
 
 /*!
@@ -27,6 +30,8 @@ class MpCCIArgs: public SIMargsBase
 {
 public:
   bool dynamic = false;
+  bool modal = false; //!< Use modal superposition for linear dynamics
+  std::vector<std::string> couplingSets; //!< Topology sets to couple on
 
   enum class Formulation {
     Linear,
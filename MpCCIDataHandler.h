@@ -16,7 +16,7 @@
 
 #include "HDF5Restart.h"
 
-#include <string_view>
+#include <string>
 #include <vector>
 
 namespace MpCCI {
@@ -33,10 +33,19 @@ public:
   virtual void writeData(int quand_it, const MeshInfo& info, double* data) const = 0;
 
   //! \brief Adds the application-specific coupling definition.
-  virtual bool addCoupling(std::string_view name, const MeshInfo& info) = 0;
+  //! \param names Names of the coupled topology sets
+  //! \param info Mesh info for the merged coupling surface of all sets
+  virtual bool addCoupling(const std::vector<std::string>& names,
+                           const MeshInfo& info) = 0;
 
   //! \brief Broadcast data to non-client ranks.
   virtual void broadcast(int& status) = 0;
+
+  //! \brief Gather interface data from non-client ranks.
+  virtual void gather() = 0;
+
+  //! \brief Returns true if displacements are written instead of positions.
+  virtual bool sendsDisplacements() const { return false; }
 };
 
 class GlobalHandler {
@@ -55,6 +64,10 @@ class ISerialize : public DataHandler {
 public:
   virtual void serializeMpCCIData(HDF5Restart::SerializeData& data) const = 0;
   virtual void deserializeMpCCIData(const HDF5Restart::SerializeData& data) = 0;
+  //! \brief Uses externally stored pressures without copying.
+  //! \param data Face pressures, must stay valid until the next update
+  //! \param size Number of face pressures
+  virtual void setMpCCIData(const double* data, size_t size) = 0;
 };
 
 }
@@ -0,0 +1,80 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MpCCIFollowerPressure.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Follower pressure loads from MpCCI for nonlinear formulations.
+//!
+//==============================================================================
+
+#ifndef MPCCI_FOLLOWER_PRESSURE_H_
+#define MPCCI_FOLLOWER_PRESSURE_H_
+
+#include "MatVec.h"
+
+#include <memory>
+#include <set>
+#include <utility>
+
+class SIMbase;
+class SystemMatrix;
+class SystemVector;
+
+namespace MpCCI {
+
+struct MeshInfo;
+class PressureLoad;
+
+/*!
+  \brief Follower pressure loads on the coupling surface.
+  \details The face pressures act on the deformed face normal, which by
+  Nanson's formula is J F^-T N dA, where F is the deformation gradient and
+  N dA the reference face normal and area. The load vector and its
+  consistent linearization with respect to the displacements are integrated
+  over the faces in MeshInfo::gelms for the current displacement iterate.
+  The load stiffness is unsymmetric.
+*/
+
+class FollowerPressure
+{
+public:
+  //! \brief Default constructor.
+  FollowerPressure();
+  //! \brief The destructor deletes the pressure load.
+  ~FollowerPressure();
+
+  //! \brief Sets up the coupling faces to integrate over.
+  //! \param info Mesh info for surface grid
+  //! \param load Pressure load providing the face pressures, taken over
+  void setup(const MeshInfo& info, PressureLoad* load);
+
+  //! \brief Releases the pressure load and coupling faces.
+  void clear();
+
+  //! \brief Returns true if the follower loads have been set up.
+  bool active() const { return load != nullptr; }
+
+  //! \brief Sets the coefficient of the load stiffness in the Newton matrix.
+  void setScale(double s) { scale = s; }
+
+  //! \brief Integrates the follower loads and their load stiffness.
+  //! \param sim The structural simulator
+  //! \param disp Current total displacements, DOF-based
+  //! \param A Newton matrix to add the load stiffness to, nullptr to skip
+  //! \param b Right-hand-side vector to add the loads to
+  bool assemble(SIMbase& sim, const Vector& disp,
+                SystemMatrix* A, SystemVector& b) const;
+
+private:
+  std::unique_ptr<PressureLoad> load; //!< Pressure load function
+  std::set<std::pair<size_t,int>> faces; //!< (patch,face) pairs to integrate
+  double scale = 1.0; //!< Coefficient of the load stiffness
+};
+
+}
+
+#endif
@@ -0,0 +1,119 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MpCCIInterfaceOutput.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Per-step output of the coupling interface state.
+//!
+//==============================================================================
+
+#ifndef MPCCI_INTERFACE_OUTPUT_H_
+#define MPCCI_INTERFACE_OUTPUT_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace MpCCI {
+
+struct MeshInfo;
+
+/*!
+  \brief Appends the coupling interface state to a binary file.
+  \details The file holds a fixed-size header and the coupling surface mesh,
+  i.e., the node coordinates and the element connectivity in local node
+  numbers, followed by one fixed-size record per step. Each record holds
+  the time, the nodal displacements, the face pressures and the nodal
+  forces, with three components per node also in 2D. The level count in
+  the header is updated after each record, so the file is valid at all
+  times and the records can be accessed directly.
+*/
+
+class InterfaceWriter
+{
+public:
+  //! \brief The constructor sets the file name.
+  explicit InterfaceWriter(const std::string& file) : fileName(file) {}
+
+  //! \brief Creates the file and writes the coupling surface mesh.
+  bool open(const MeshInfo& info);
+
+  //! \brief Returns the number of values in a record, excluding the time.
+  size_t size() const { return recordSize; }
+
+  //! \brief Appends a record to the file.
+  //! \param time Physical time of the record
+  //! \param state Displacements, pressures and forces, see SIMStructure
+  bool write(double time, const std::vector<double>& state);
+
+private:
+  std::string fileName; //!< Name of file
+  std::ofstream os; //!< Output stream
+  size_t recordSize = 0; //!< Number of values in a record
+  uint64_t nLevels = 0; //!< Number of records written
+};
+
+
+/*!
+  \brief Memory mapped reader for interface output files.
+*/
+
+class InterfaceFile
+{
+public:
+  //! \brief Default constructor.
+  InterfaceFile() = default;
+  //! \brief No copying allowed.
+  InterfaceFile(const InterfaceFile&) = delete;
+  //! \brief The destructor unmaps the file.
+  ~InterfaceFile();
+
+  //! \brief Maps an interface output file.
+  //! \return False if the file is missing or not a valid interface file
+  bool open(const std::string& file);
+
+  //! \brief Returns the number of surface nodes.
+  size_t nodes() const { return nNodes; }
+  //! \brief Returns the number of surface elements.
+  size_t faces() const { return nFaces; }
+  //! \brief Returns the number of nodes per surface element.
+  int nodesPerFace() const { return npe; }
+  //! \brief Returns the number of records in the file.
+  int levels() const { return nLevels; }
+
+  //! \brief Returns the node coordinates, three per node.
+  const double* coords() const;
+  //! \brief Returns the element connectivity in local node numbers.
+  const int32_t* elements() const;
+
+  //! \brief Returns the time of a record, or NaN if out of range.
+  double time(int level) const;
+  //! \brief Returns the nodal displacements of a record, three per node.
+  const double* displacements(int level) const;
+  //! \brief Returns the face pressures of a record.
+  const double* pressures(int level) const;
+  //! \brief Returns the nodal forces of a record, three per node.
+  const double* forces(int level) const;
+
+private:
+  //! \brief Returns the start of a record, or nullptr if out of range.
+  const double* record(int level) const;
+
+  void* map = nullptr; //!< Start of the memory mapping
+  size_t mapSize = 0; //!< Size of the memory mapping
+  size_t nNodes = 0; //!< Number of surface nodes
+  size_t nFaces = 0; //!< Number of surface elements
+  int npe = 0; //!< Number of nodes per surface element
+  int nLevels = 0; //!< Number of records
+  size_t dataStart = 0; //!< Offset of first record
+};
+
+}
+
+#endif
@@ -0,0 +1,91 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MpCCIInterfacePlan.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Communication plan for distributing MpCCI coupling data.
+//!
+//==============================================================================
+
+#ifndef MPCCI_INTERFACE_PLAN_H_
+#define MPCCI_INTERFACE_PLAN_H_
+
+#include <vector>
+
+class ProcessAdm;
+class SIMinput;
+
+namespace MpCCI {
+
+struct MeshInfo;
+
+/*!
+  \brief Communication plan for coupling data in partitioned runs.
+  \details The MpCCI client rank (rank 0) holds the global coupling mesh,
+  while the other ranks hold only the surface elements they own.
+  The plan records which ranks own which coupling faces and nodes, such
+  that face values are scattered to, and owned interface node values are
+  gathered from, only the relevant ranks.
+  Each interface node is owned by exactly one rank.
+*/
+
+class InterfacePlan
+{
+public:
+  //! \brief Establishes the communication plan.
+  //! \details This is a collective operation. The plan is only activated
+  //! if at least one rank holds a local (partitioned) coupling mesh.
+  //! \param sim The simulator holding the FE model
+  //! \param info Coupling mesh, global on rank 0 and local on other ranks
+  void setup(const SIMinput& sim, const MeshInfo& info);
+
+  //! \brief Returns true if the plan is active.
+  bool active() const { return isActive; }
+
+  //! \brief Returns indices into MeshInfo::nodes of nodes owned by this rank.
+  const std::vector<int>& ownedNodes() const { return myNodes; }
+
+  //! \brief Scatters face values from the client rank to the owners.
+  //! \param global Global face values (client rank only)
+  //! \param local Local face values, ordered as the local MeshInfo::gelms
+  void scatterFaces(const double* global, double* local) const;
+
+  //! \brief Scatters node values from the client rank to the owners.
+  //! \param global Global node values (client rank only)
+  //! \param local Values for the owned nodes, ordered as ownedNodes()
+  //! \param ncomp Number of components per node
+  void scatterNodes(const double* global, double* local, int ncomp) const;
+
+  //! \brief Gathers node values from the owners on the client rank.
+  //! \param local Values for the owned nodes, ordered as ownedNodes()
+  //! \param global Global node values (client rank only)
+  //! \param ncomp Number of components per node
+  void gatherNodes(const double* local, double* global, int ncomp) const;
+
+private:
+  const ProcessAdm* adm = nullptr; //!< Process administrator
+  bool isActive = false; //!< True if the plan is active
+  int nLocalFaces = 0; //!< Number of faces on this rank
+
+  std::vector<int> myNodes; //!< Owned nodes as indices into MeshInfo::nodes
+
+  // The following are only populated on the client rank
+  std::vector<int> faceCounts; //!< Number of faces per rank
+  std::vector<int> faceDispl; //!< Offset of faces per rank
+  std::vector<int> faceIdx; //!< Global face indices, ordered by rank
+  std::vector<int> nodeCounts; //!< Number of owned nodes per rank
+  std::vector<int> nodeDispl; //!< Offset of owned nodes per rank
+  std::vector<int> nodeIdx; //!< Global node indices, ordered by rank
+
+  mutable std::vector<double> buffer; //!< Packing buffer
+  mutable std::vector<int> counts; //!< Scaled counts
+  mutable std::vector<int> displs; //!< Scaled offsets
+};
+
+}
+
+#endif
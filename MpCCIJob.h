@@ -18,8 +18,11 @@
 
 #include "MpCCIDataHandler.h"
 #include "MpCCIMeshData.h"
+#include "MpCCIMetrics.h"
 
 #include <iosfwd>
+#include <map>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -31,11 +34,19 @@ namespace MpCCI {
 
 //! \brief Class handling a MpCCI job.
 //! \details Only a single instance is allowed.
+//! Each coupled part defined by the server is a topology set in the model.
+//! The parts are merged into one coupling mesh for the data handler, and
+//! the values of all parts are exchanged with it in a single pass.
+//! For 2D models the line element parts may be extruded into a slab,
+//! to couple with a 3D fluid model of the same thickness.
 class Job
 {
 public:
   static Job* globalInstance; //!< Singleton static pointer
   static bool dryRun; //!< To perform a dry run - used in tests
+  static std::string meshCache; //!< Coupling mesh cache file, empty to disable
+  static double slabThickness; //!< Extrusion thickness for 2D models, 0 to disable
+  static double startTime; //!< Physical time the coupled run starts at
 
   //! \brief The constructor initializes the MpCCI job.
   Job(SIMinput& simulator, const double dt,
@@ -66,23 +77,60 @@ public:
   static void putGlobalValues (const MPCCI_GLOB* glob, void* values);
 
   //! \brief Execute data transfer.
-  int transfer(int status, TimeDomain& time);
+  //! \param status Convergence state sent to the server
+  //! \param time Current time domain
+  //! \param iter Coupling iteration within the time step, -1 for explicit
+  int transfer(int status, TimeDomain& time, int iter = -1);
+
+  //! \brief Sets the metrics to record the transfer phases in.
+  void setMetrics(Metrics* m);
 
   void done();
 
 private:
+  //! \brief A coupled part defined by the server.
+  struct Part {
+    int meshId = 0; //!< MpCCI mesh id
+    int partId = 0; //!< MpCCI part id
+    std::string name; //!< Name of topology set
+    MeshInfo info; //!< Part mesh info
+    MeshInfo slab; //!< Extruded part mesh, empty if not extruded
+    std::vector<int> slabMap; //!< Part node index of each extruded node
+    std::vector<int> nodeMap; //!< Coupling mesh node index of each server node
+    size_t faceOffset = 0; //!< Coupling mesh index of first part element
+
+    //! \brief Returns the mesh defined for the server.
+    const MeshInfo& server() const { return slab.nodes.empty() ? info : slab; }
+  };
+
   //! \brief Establish connect to MpCCI.
   void establishConnection(const double dt);
 
-  //! \brief Setup mesh data
-  bool setupMeshData(std::string name);
+  //! \brief Sets up the mesh data of a part defined by the server.
+  Part& addPart(const MPCCI_PART* part);
+
+  //! \brief Sets up the merged coupling mesh for all parts.
+  //! \details The parts are distributed from the client rank.
+  bool setupMeshData();
+
+  //! \brief Returns the part with given MpCCI ids.
+  const Part& findPart(const MPCCI_PART* part) const;
+
+  //! \brief Passes the values received for all parts to the data handler.
+  void unpackValues();
 
   MPCCI_JOB* mpcciJob{nullptr}; //!< MpCCI job info structure
   MPCCI_TINFO mpcciTinfo{0}; //!< MpCCI time step information
-  MeshInfo meshInfo; //!< Coupling mesh info
+  std::vector<Part> parts; //!< Coupled parts
+  MeshInfo meshInfo; //!< Coupling mesh info, merged for all parts
+  std::vector<double> sendValues; //!< Values to send for all parts
+  int packedQuant = -1; //!< Quantity in \a sendValues, -1 if none
+  std::map<int,std::vector<double>> recvValues; //!< Received values for all parts
+  std::vector<int> recvQuants; //!< Quantities received in current transfer
   SIMinput& sim; //!< Reference to IFEM simulator
   DataHandler* handler; //!< Data handler
   GlobalHandler* ghandler; //!< Global data handler
+  Metrics* metrics = nullptr; //!< Per-step metrics, may be nullptr
 };
 
 }
@@ -0,0 +1,69 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MpCCIMeshCache.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief On-disk cache for IFEM<->MpCCI coupling meshes.
+//!
+//==============================================================================
+
+#ifndef MPCCI_MESHCACHE_H_
+#define MPCCI_MESHCACHE_H_
+
+#include "MpCCIMeshData.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class SIMinput;
+
+namespace MpCCI {
+
+//! \brief Computes the cache key for a coupling mesh.
+//! \details The key is a hash of the coupling set definition, the order
+//! and size of the patches involved, the control points on the coupling
+//! boundaries and, for local meshes, the element partitioning.
+//! \param name Name of topology set
+//! \param sim The simulator holding the FE model
+//! \param local True for a mesh containing only locally owned elements
+uint64_t meshKey(std::string_view name, const SIMinput& sim, bool local);
+
+//! \brief Loads a coupling mesh from a cache file.
+//! \param file Name of cache file
+//! \param key Expected cache key
+//! \param info The loaded coupling mesh
+//! \return False if the file is missing, invalid or stale
+bool loadMeshCache(const std::string& file, uint64_t key, MeshInfo& info);
+
+//! \brief Saves a coupling mesh to a cache file.
+//! \param file Name of cache file
+//! \param key Cache key
+//! \param info The coupling mesh to save
+bool saveMeshCache(const std::string& file, uint64_t key, const MeshInfo& info);
+
+//! \brief Establishes the coupling mesh, using a cache file when valid.
+//! \param name Name of topology set
+//! \param sim The simulator holding the FE model
+//! \param local If true, only include elements owned by this process
+//! \param cacheFile Name of cache file, empty to disable caching.
+//! The name of the topology set is inserted before the file extension.
+MeshInfo cachedMeshData(std::string_view name, const SIMinput& sim,
+                        bool local, const std::string& cacheFile);
+
+//! \brief Establishes the merged coupling mesh of several topology sets.
+//! \details Only valid for global meshes.
+//! \param names Names of topology sets
+//! \param sim The simulator holding the FE model
+//! \param cacheFile Name of cache file, empty to disable caching
+MeshInfo cachedMeshData(const std::vector<std::string>& names,
+                        const SIMinput& sim, const std::string& cacheFile);
+
+}
+
+#endif
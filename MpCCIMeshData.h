@@ -18,6 +18,7 @@
 #include <utility>
 #include <vector>
 
+class ASMbase;
 class SIMinput;
 
 namespace MpCCI {
@@ -28,12 +29,73 @@ struct MeshInfo {
   std::vector<double> coords; //!< Coordinates for nodes on interface
   std::vector<int> elms; //!< Element node indices on interface
   std::vector<std::pair<int,int>> gelms; //!< Global element numbers for surface
+  std::vector<int> patches; //!< Patch index for each surface element
+  std::vector<int> slots; //!< Global surface element index (local meshes only)
+  std::vector<int> cells; //!< Greville cell index on the patch boundary, -1 for element faces
   unsigned type; //!< Type of elements
   int node_per_elm; //!< Nodes per element
+  bool local = false; //!< True if only elements owned by this process are included
 };
 std::ostream& operator<<(std::ostream&, const MeshInfo&);
 
-MeshInfo meshData(std::string_view name, const SIMinput& sim);
+//! \brief Establishes the coupling mesh for a topology set.
+//! \details Faces of 3D models give QUAD4/QUAD9 elements, and edges of
+//! 2D models give LINE2/LINE3 elements. Spline patches of higher order give
+//! a linear surrogate mesh through the Greville points of the boundary
+//! control points, with one surface element per Greville cell.
+//! \param name Name of topology set
+//! \param sim The simulator holding the FE model
+//! \param local If true, only include elements owned by this process
+MeshInfo meshData(std::string_view name, const SIMinput& sim,
+                  bool local = false);
+
+//! \brief Returns the 1-based index of the patch element containing a point.
+//! \param pch The 2D or 3D patch
+//! \param u Parameters of the point
+int elementContaining(const ASMbase& pch, const double* u);
+
+//! \brief Returns the Greville parameters of a 2D or 3D spline patch.
+//! \param pch The patch
+//! \param dir 0-based parameter direction
+//! \param prm The Greville parameters
+bool grevilleParameters(const ASMbase& pch, int dir, std::vector<double>& prm);
+
+//! \brief Returns the indices of the surface elements owned by this process.
+std::vector<int> ownedElements(const MeshInfo& info, const SIMinput& sim);
+
+//! \brief Merges the meshes of several coupling parts into one.
+//! \details The nodes of the merged mesh are the sorted union of the part
+//! nodes, and the surface elements of the parts follow each other.
+//! \param parts The part meshes
+//! \param nFaces Number of surface elements in the global mesh of each part,
+//! used to offset the slots of local meshes
+//! \param nodeMap Index in the merged mesh of each part node
+//! \param faceOffset Index in the merged mesh of the first element of each part
+MeshInfo mergeMeshes(const std::vector<const MeshInfo*>& parts,
+                     const std::vector<int>& nFaces,
+                     std::vector<std::vector<int>>& nodeMap,
+                     std::vector<size_t>& faceOffset);
+
+//! \brief Extrudes a 2D coupling mesh of line elements into a slab.
+//! \details Each line element gives one quadrilateral element through the
+//! thickness, such that the face values of the two meshes coincide.
+//! The nodes of the first layer are in the plane of the 2D model, and each
+//! following layer is numbered after the previous one.
+//! \param info The line element mesh
+//! \param thickness Slab thickness in the out-of-plane direction
+//! \param nodeMap Index in \a info of each node of the extruded mesh
+MeshInfo extrudeMesh(const MeshInfo& info, double thickness,
+                     std::vector<int>& nodeMap);
+
+//! \brief Offsets positions of the 2D model nodes to the layers of a slab.
+//! \details Only positions are offset, displacements are the same in all
+//! layers of the slab.
+//! \param slab The extruded mesh
+//! \param info The line element mesh
+//! \param nodeMap Index in \a info of each node of the extruded mesh
+//! \param values Three position components for each node of \a slab
+void addSlabOffsets(const MeshInfo& slab, const MeshInfo& info,
+                    const std::vector<int>& nodeMap, double* values);
 
 }
 
@@ -0,0 +1,116 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MpCCIMetrics.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Per-step metrics for IFEM MpCCI coupled simulations.
+//!
+//==============================================================================
+
+#ifndef MPCCI_METRICS_H_
+#define MPCCI_METRICS_H_
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <map>
+#include <string>
+#include <utility>
+
+namespace MpCCI {
+
+/*!
+  \brief Collects and writes per-step coupling metrics.
+  \details For each coupling step, the wall time spent in each phase,
+  the number of bytes exchanged per quantity and the coupling mesh size
+  are recorded. The records are written as JSON lines, or as CSV where
+  only the total number of bytes sent and received are given.
+  The \a wait phase is the time spent inside the data transfer outside
+  of the adapter callbacks, i.e., waiting for the other codes.
+*/
+
+class Metrics
+{
+public:
+  //! \brief Phases of a coupling step.
+  enum Phase {
+    GATHER,    //!< Gathering interface data from other ranks
+    TRANSFER,  //!< Complete data transfer, including callbacks
+    GET,       //!< Callbacks sending data
+    PUT,       //!< Callbacks receiving data
+    GLOBAL,    //!< Callbacks exchanging global values
+    BROADCAST, //!< Distributing received data to other ranks
+    SOLVE,     //!< Structural solve
+    OUTPUT,    //!< Result output
+    NPHASES    //!< Number of phases
+  };
+
+  //! \brief Accumulates the wall time of a scope into a phase.
+  class Scope
+  {
+  public:
+    //! \brief The constructor starts the timer.
+    //! \param m Metrics to add time to, may be nullptr
+    //! \param p Phase to add time to
+    Scope(Metrics* m, Phase p) : metrics(m), phase(p),
+      start(std::chrono::steady_clock::now()) {}
+    //! \brief The destructor adds the elapsed time.
+    ~Scope()
+    {
+      if (metrics)
+        metrics->add(phase, std::chrono::duration<double>(
+                            std::chrono::steady_clock::now() - start).count());
+    }
+
+  private:
+    Metrics* metrics; //!< Metrics to add time to
+    Phase phase; //!< Phase to add time to
+    std::chrono::steady_clock::time_point start; //!< Start time
+  };
+
+  //! \brief Opens the metrics file.
+  //! \param file Name of file, CSV format if the extension is .csv
+  bool open(const std::string& file);
+
+  //! \brief Returns true if metrics are being written.
+  bool active() const { return os.is_open(); }
+
+  //! \brief Adds wall time to a phase of the current step.
+  void add(Phase phase, double seconds) { times[phase] += seconds; }
+
+  //! \brief Adds exchanged bytes for a quantity in the current step.
+  //! \param qid Quantity identifier
+  //! \param sent Number of bytes sent
+  //! \param received Number of bytes received
+  void addBytes(int qid, size_t sent, size_t received);
+
+  //! \brief Sets the number of coupling iterations in the current step.
+  void setIterations(int iter) { nIter = iter; }
+
+  //! \brief Sets the coupling mesh size.
+  void setMesh(size_t nodes, size_t faces);
+
+  //! \brief Writes the record for the current step and starts a new one.
+  //! \param step Time step number
+  //! \param time Current time
+  //! \param state Convergence state of the step
+  void endStep(int step, double time, int state);
+
+private:
+  std::ofstream os; //!< Output stream
+  bool csv = false; //!< True to write CSV instead of JSON lines
+  size_t nNodes = 0; //!< Number of interface nodes
+  size_t nFaces = 0; //!< Number of interface faces
+  int nIter = 1; //!< Number of coupling iterations in current step
+  std::array<double,NPHASES> times{}; //!< Wall time per phase
+  std::map<int,std::pair<size_t,size_t>> bytes; //!< Bytes exchanged per quantity
+};
+
+}
+
+#endif
@@ -16,17 +16,32 @@
 
 #include "MpCCIDataHandler.h"
 #include "MpCCIMeshData.h"
+#include "MpCCIMetrics.h"
+#include "MpCCIReplay.h"
 
 #include <memory>
+#include <string>
+#include <vector>
 
-class HDF5Restart;
 class MeshInfo;
 class SIMinput;
 struct TimeDomain;
 
 namespace MpCCI {
 
-//! \brief Class mocking a MpCCI job.
+class CompressedReplayFile;
+
+/*!
+  \brief Class mocking a MpCCI job.
+  \details Replays recorded coupling data. If a compressed replay file
+  (<name>.rpz) exists, the pressures are decoded from it. Otherwise, if a
+  binary replay file (<name>.bin) exists, the pressures are used directly
+  from the memory mapped file. Otherwise the HDF5 data are read one step
+  ahead on a background thread. If the physical time of each level is recorded, the
+  pressures are interpolated in time to the end of each structural step,
+  such that the structural time step may differ from the recorded one.
+  Otherwise level k is used for step k.
+*/
 class MockJob
 {
 public:
@@ -35,13 +50,34 @@ public:
           DataHandler* = nullptr,
           GlobalHandler* = nullptr);
 
+  //! \brief The destructor waits for any pending reads.
+  ~MockJob();
+
   //! \brief Set the input name and creates the coupling.
+  //! \param name Name of recorded coupling data file
+  //! \param couplingSets Names of topology sets to couple on
+  //! \param isim The simulator holding the FE model
+  //! \param meshCache Coupling mesh cache file, empty to disable
+  //! \param scheme Interpolation in time of the recorded data
   void setInputFile(std::string_view name,
-                    std::string_view couplingSet,
-                    const SIMinput& isim);
+                    const std::vector<std::string>& couplingSets,
+                    const SIMinput& isim,
+                    const std::string& meshCache = "",
+                    ReplayResampler::Scheme scheme =
+                      ReplayResampler::Scheme::Linear);
 
   //! \brief Execute data transfer.
-  int transfer(int status, TimeDomain& time);
+  //! \details The recorded data is only advanced in the first coupling
+  //! iteration of a time step, later iterations reuse the same loads.
+  int transfer(int status, TimeDomain& time, int iter = -1);
+
+  //! \brief Continues the replay after a given time step, when restarting.
+  //! \details Only needed without recorded times, otherwise the levels
+  //! are located from the time of the step.
+  void setStep(int step) { m_level = step + 1; }
+
+  //! \brief Sets the metrics to record the replay reads in.
+  void setMetrics(Metrics* m);
 
   //! \brief We are done.
   void done() {}
@@ -50,7 +86,11 @@ private:
   ISerialize& sim; //!< Reference to IFEM simulator
   int m_level = 1; //!< Current level to read
   MeshInfo m_info; //!< Mesh information
-  std::unique_ptr<HDF5Restart> m_reader; //!< Serialized data reader
+  Metrics* m_metrics = nullptr; //!< Per-step metrics, may be nullptr
+  std::unique_ptr<ReplayPrefetcher> m_reader; //!< Serialized data reader
+  std::unique_ptr<ReplayFile> m_file; //!< Memory mapped binary replay data
+  std::unique_ptr<CompressedReplayFile> m_packed; //!< Compressed replay data
+  std::unique_ptr<ReplayResampler> m_resampler; //!< Time interpolation of replay data
 };
 
 }
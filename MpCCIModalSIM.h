@@ -0,0 +1,105 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MpCCIModalSIM.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Modal superposition time integrator for IFEM MpCCI.
+//!
+//==============================================================================
+
+#ifndef MPCCI_MODAL_SIM_H_
+#define MPCCI_MODAL_SIM_H_
+
+#include "HDF5Restart.h"
+#include "MatVec.h"
+#include "SIMenums.h"
+
+#include <vector>
+
+class TimeStep;
+
+
+namespace MpCCI {
+
+/*!
+  \brief Reduced-order structural time integrator using modal superposition.
+  \details The lowest eigenmodes of the linear structure are computed once,
+  and the uncoupled modal equations are integrated in time with the Newmark
+  method. The coupling loads are projected onto the modes through the
+  coupling faces, and the interface displacements are reconstructed at the
+  coupling nodes only. The full displacement field is only reconstructed
+  on request, e.g., for result output.
+
+  The class provides the subset of the NewmarkSIM interface used by
+  MpCCI::SIMSolver, and can be used as its time integrator.
+  The settings are given as
+  \code
+  <mpcci>
+    <modal modes="10" damping="0.01" beta="0.25" gamma="0.5"/>
+  </mpcci>
+  \endcode
+  where \a damping is the modal damping ratio.
+*/
+
+template<class Model> class ModalSIM
+{
+public:
+  //! \brief The constructor initializes the model reference.
+  explicit ModalSIM(Model& sim) : model(sim) {}
+
+  //! \brief Reads the model and the modal settings from an input file.
+  bool read(const char* fileName);
+
+  //! \brief Computes the eigenmodes of the structure.
+  bool initEqSystem(bool withRF = false);
+
+  //! \brief Initializes the modal solution vectors.
+  void initSol(int = 3);
+  //! \brief Present for compatibility with NewmarkSIM.
+  void initPrm() {}
+
+  //! \brief Prints the modal frequencies.
+  void printProblem() const;
+
+  //! \brief Advances the modal solution to the next time step.
+  bool advanceStep(TimeStep&, bool = true);
+
+  //! \brief Integrates the modal equations over a time step.
+  SIM::ConvStatus solveStep(TimeStep& tp);
+
+  //! \brief Returns the reconstructed displacement field.
+  const Vector& getSolution(int = 0);
+  //! \brief Returns the modal coordinates.
+  const std::vector<double>& getModalSolution() const { return q; }
+
+  //! \brief Serializes the modal solution state.
+  bool serialize(HDF5Restart::SerializeData& data) const;
+  //! \brief Restores the modal solution state.
+  bool deSerialize(const HDF5Restart::SerializeData& data);
+
+private:
+  Model& model; //!< The structural model
+
+  int nModes = 10; //!< Number of modes
+  double damping = 0.0; //!< Modal damping ratio
+  double beta = 0.25; //!< Newmark time integration parameter
+  double gamma = 0.5; //!< Newmark time integration parameter
+
+  std::vector<double> omega; //!< Angular eigenfrequencies
+  std::vector<Vector> modes; //!< Mass-normalized mode shapes, DOF-based
+  std::vector<Vector> eqModes; //!< Mode shapes, equation-based
+  bool haveBasis = false; //!< True when coupling projections are set up
+
+  std::vector<double> q, v, a; //!< Modal state at end of time step
+  std::vector<double> q0, v0, a0; //!< Modal state at start of time step
+  std::vector<double> f; //!< Modal loads
+  Vector solution; //!< Reconstructed displacement field
+};
+
+}
+
+#endif
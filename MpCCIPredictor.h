@@ -0,0 +1,71 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MpCCIPredictor.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Extrapolation of interface data in time for IFEM MpCCI.
+//!
+//==============================================================================
+
+#ifndef MPCCI_PREDICTOR_H_
+#define MPCCI_PREDICTOR_H_
+
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace MpCCI {
+
+/*!
+  \brief Predicts interface data by polynomial extrapolation in time.
+  \details The values of the last few time levels are kept, and the values
+  at a later time are extrapolated with a Lagrange polynomial of the given
+  order. While fewer levels are available the order is reduced.
+*/
+
+class Predictor
+{
+public:
+  //! \brief The constructor sets the extrapolation order.
+  //! \param order 0 for constant, 1 for linear or 2 for quadratic
+  explicit Predictor(int order = 1) { this->setOrder(order); }
+
+  //! \brief Sets the extrapolation order.
+  void setOrder(int order);
+
+  //! \brief Adds the values of a new time level.
+  //! \details If the number of values differs from that of the stored
+  //! levels, e.g., after the interface changed, the stored levels are removed.
+  //! \param t Time of the level
+  //! \param values The values
+  //! \param n Number of values
+  void push(double t, const double* values, size_t n);
+
+  //! \brief Extrapolates the values to a given time.
+  //! \return False if no time levels are available
+  bool predict(double t, std::vector<double>& values) const;
+
+  //! \brief Removes all time levels.
+  void clear() { levels.clear(); }
+
+  //! \brief Appends the stored time levels to a checkpoint buffer.
+  void serialize(std::string& str) const;
+  //! \brief Restores the stored time levels from a checkpoint buffer.
+  //! \param str The checkpoint buffer
+  //! \param pos Position in \a str, advanced past the time levels
+  bool deSerialize(const std::string& str, size_t& pos);
+
+private:
+  int order = 1; //!< Extrapolation order
+  std::deque<std::pair<double,std::vector<double>>> levels; //!< Newest first
+};
+
+}
+
+#endif
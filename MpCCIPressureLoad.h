@@ -15,6 +15,8 @@
 #define MPCCI_PRESSURE_LOAD_
 
 #include "Function.h"
+
+#include <unordered_map>
 #include <vector>
 
 class ASMbase;
@@ -24,10 +26,14 @@ namespace MpCCI {
 struct MeshInfo;
 
 //! \brief Function for scalar pressure load fed from MpCCI.
+//! \details Handles faces of ASMs3D patches and edges of ASMs2D patches.
+//! For spline surrogate surfaces the pressure of the Greville cell
+//! containing each integration point is used.
 class PressureLoad : public RealFunc
 {
 public:
   //! \brief Constructor.
+  //! \param pch The patches of the FE model
   //! \param info Mesh info for surface grid
   //! \param values Reference to vector of pressure values
   PressureLoad(const std::vector<ASMbase*>& pch,
@@ -39,14 +45,45 @@ public:
   //! \brief Sets the active patch.
   bool initPatch(size_t pid) override;
 
+  //! \brief Redirects the pressure values to external storage.
+  //! \param values External pressure values, nullptr to use the vector
+  void setValues(const double* values) { m_external = values; }
+
+  //! \brief Returns the pressure slot for an element face, or -1 if none.
+  //! \param pid 1-based patch index
+  //! \param iel 0-based patch-local element index
+  //! \param face 1-based local face index, or edge index for 2D patches
+  int getSlot(size_t pid, int iel, int face) const;
+
+  //! \brief Returns true if the surface has Greville cell surrogate elements.
+  //! \details Such pressures vary within the patch elements.
+  bool hasCells() const { return !m_info.cells.empty(); }
+
 private:
+  //! \brief Builds the (element,face) to pressure slot index.
+  void buildIndex();
+
+  //! \brief Returns the pressure slot for a point in the current patch
+  //! from its Greville cell, or -1 if none.
+  //! \param face 1-based local face index
+  //! \param u Parameters of the point
+  int getCellSlot(int face, const double* u) const;
+
   //! \brief Determines which domain boundary point is on.
+  //! \return 1-based face index, 0 if the point is not on a boundary
   int getDirection(const double* u) const;
 
+  //! \brief Hash table mapping (element,face) to pressure slot.
+  using SlotMap = std::unordered_map<int,int>;
+
   const std::vector<ASMbase*>& m_patches; //!< Reference to underlying patch
   const MeshInfo& m_info; //!< Reference to mesh info for surface grid
   const std::vector<double>& m_values; //!< Reference to vector of pressure values
+  const double* m_external = nullptr; //!< External pressure values
   std::vector<std::vector<Real>> m_domain; //!< Parameter domain
+  std::vector<SlotMap> m_index; //!< Pressure slot index for each patch
+  std::vector<SlotMap> m_cells; //!< Greville cell pressure slot index for each patch
+  std::vector<std::vector<Real>> m_greville; //!< Greville parameters of current patch
   size_t m_pid = 0; //!< Current patch ID
 };
 
@@ -0,0 +1,75 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MpCCIPressureOperator.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Precomputed operator mapping MpCCI face pressures to nodal loads.
+//!
+//==============================================================================
+
+#ifndef MPCCI_PRESSURE_OPERATOR_H_
+#define MPCCI_PRESSURE_OPERATOR_H_
+
+#include <cstddef>
+#include <vector>
+
+class SIMbase;
+
+namespace MpCCI {
+
+struct MeshInfo;
+class PressureLoad;
+
+/*!
+  \brief Sparse operator mapping per-face pressures to right-hand-side entries.
+  \details The face shape functions are integrated once over the coupling
+  surface. Each column of the operator corresponds to one surface element
+  in MeshInfo::gelms, each row to a (1-based) equation number.
+  The geometry is assumed fixed, i.e., this is only valid for a linear
+  formulation.
+*/
+
+class PressureOperator
+{
+public:
+  //! \brief Integrates the face shape functions over the coupling surface.
+  //! \param sim The structural simulator
+  //! \param info Mesh info for surface grid
+  //! \param index Pressure load providing the face to pressure slot index
+  //! \return False if the operator could not be established,
+  //! e.g. due to multi-point constraints on the coupling surface
+  bool build(SIMbase& sim, const MeshInfo& info, const PressureLoad& index);
+
+  //! \brief Adds the nodal loads for given face pressures to a vector.
+  //! \param pressures Face pressures, one per surface element
+  //! \param b Right-hand-side vector to add the nodal loads to
+  void apply(const double* pressures, double* b) const;
+
+  //! \brief Projects an equation vector onto the face pressures.
+  //! \details This applies the transposed operator.
+  //! \param v Vector with one value per equation
+  //! \param out Projected values, one per surface element
+  void project(const double* v, double* out) const;
+
+  //! \brief Clears the operator.
+  void clear();
+
+  //! \brief Returns true if the operator has been established.
+  bool empty() const { return colPtr.empty(); }
+
+  //! \brief Returns the number of nonzero entries in the operator.
+  size_t nonZeros() const { return vals.size(); }
+
+private:
+  std::vector<size_t> colPtr; //!< Start of each column in \a rowIdx
+  std::vector<int> rowIdx; //!< 0-based equation number of each entry
+  std::vector<double> vals; //!< Value of each entry
+};
+
+}
+
+#endif
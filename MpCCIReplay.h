@@ -0,0 +1,262 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MpCCIReplay.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Readers and writers for recorded MpCCI coupling data.
+//!
+//==============================================================================
+
+#ifndef MPCCI_REPLAY_H_
+#define MPCCI_REPLAY_H_
+
+#include "HDF5Restart.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace MpCCI {
+
+//! \brief Returns the mutex serializing HDF5 library calls between threads.
+std::mutex& hdf5Mutex();
+
+
+/*!
+  \brief Memory mapped reader for recorded coupling data in binary format.
+  \details The file holds a fixed-size header followed by the physical time
+  and the array of face pressures of each level. The pressure array of a
+  level is handed out as a pointer directly into the mapping, so no copies
+  are made. Files written before the times were recorded are also read.
+*/
+
+class ReplayFile
+{
+public:
+  //! \brief Default constructor.
+  ReplayFile() = default;
+  //! \brief No copying allowed.
+  ReplayFile(const ReplayFile&) = delete;
+  //! \brief The destructor unmaps the file.
+  ~ReplayFile();
+
+  //! \brief Maps a binary coupling data file.
+  //! \return False if the file is missing or not a valid replay file
+  bool open(const std::string& file);
+
+  //! \brief Returns the number of values per level.
+  size_t size() const { return nValues; }
+  //! \brief Returns the number of levels in the file.
+  int levels() const { return nLevels; }
+  //! \brief Returns true if the file holds the physical time of each level.
+  bool timed() const { return stride > nValues; }
+
+  //! \brief Returns the values of a level, or nullptr if out of range.
+  //! \param level 0-based level index
+  const double* level(int level) const;
+  //! \brief Returns the physical time of a level, NaN if not recorded.
+  //! \param level 0-based level index
+  double time(int level) const;
+
+private:
+  void* map = nullptr; //!< Start of the memory mapping
+  size_t mapSize = 0; //!< Size of the memory mapping
+  size_t nValues = 0; //!< Number of values per level
+  size_t stride = 0; //!< Number of doubles per level record
+  int nLevels = 0; //!< Number of levels
+};
+
+
+/*!
+  \brief Appends coupling data levels to a binary replay file.
+  \details The file is created on the first level holding data. Levels
+  written before that, e.g., the initial state before the coupling is
+  established, are stored as zeros so that level indices are preserved.
+*/
+
+class ReplayWriter
+{
+public:
+  //! \brief The constructor sets the file name.
+  explicit ReplayWriter(const std::string& file) : fileName(file) {}
+
+  //! \brief Appends a level to the file.
+  //! \param time Physical time of the level
+  //! \param values Values to write
+  //! \param size Number of values, must be the same for all non-empty levels
+  bool write(double time, const double* values, size_t size);
+
+private:
+  std::string fileName; //!< Name of file
+  std::ofstream os; //!< Output stream
+  uint64_t nValues = 0; //!< Number of values per level
+  uint64_t nLevels = 0; //!< Number of levels written
+  std::vector<double> emptyTimes; //!< Times of levels before the file exists
+};
+
+
+/*!
+  \brief Writes coupling data snapshots on a dedicated I/O thread.
+  \details Each snapshot is copied into a pooled buffer and queued for
+  the I/O thread, such that the caller is only blocked when the queue
+  is full.
+*/
+
+class AsyncWriter
+{
+public:
+  //! \brief Function writing a snapshot, returns false on failure.
+  using Sink = std::function<bool(double, const std::vector<double>&)>;
+
+  //! \brief The constructor starts the I/O thread.
+  //! \param sink Function writing a snapshot
+  //! \param depth Maximum number of queued snapshots
+  //! \param threaded If false, snapshots are written immediately
+  AsyncWriter(Sink sink, size_t depth, bool threaded = true);
+  //! \brief No copying allowed.
+  AsyncWriter(const AsyncWriter&) = delete;
+  //! \brief The destructor writes all queued snapshots.
+  ~AsyncWriter();
+
+  //! \brief Queues a snapshot for writing.
+  //! \param time Physical time of the snapshot
+  //! \param values Values to write
+  //! \param size Number of values
+  void push(double time, const double* values, size_t size);
+
+  //! \brief Waits until all queued snapshots have been written.
+  //! \return False if any write failed
+  bool flush();
+
+private:
+  //! \brief Main loop of the I/O thread.
+  void run();
+  //! \brief Records the outcome of a write, logging the first failure.
+  //! \param time Physical time of the snapshot
+  //! \param ok False if the write failed
+  void report(double time, bool ok);
+
+  Sink sink; //!< Function writing a snapshot
+  size_t maxDepth; //!< Maximum number of queued snapshots
+  std::mutex mutex; //!< Mutex protecting the queue
+  std::condition_variable cond; //!< Signals queue changes
+  std::deque<std::pair<double,std::vector<double>>> queue; //!< Queued snapshots
+  std::vector<std::vector<double>> pool; //!< Free snapshot buffers
+  bool busy = false; //!< True while the I/O thread is writing
+  bool stop = false; //!< True to stop the I/O thread
+  bool failed = false; //!< True if a write failed
+  std::thread worker; //!< The I/O thread
+};
+
+
+/*!
+  \brief Reader for recorded HDF5 coupling data with read-ahead.
+  \details When a level is handed out, the next level is read on a
+  background thread while the current step is being solved.
+*/
+
+class ReplayPrefetcher
+{
+public:
+  //! \brief The constructor opens the HDF5 file.
+  explicit ReplayPrefetcher(const std::string& file);
+  //! \brief The destructor waits for any pending read.
+  ~ReplayPrefetcher();
+
+  //! \brief Obtains the data for a level and starts reading the next.
+  //! \param level Level to read
+  //! \param data The level data
+  bool next(int level, HDF5Restart::SerializeData& data);
+
+private:
+  //! \brief Reads a level, holding the HDF5 mutex.
+  bool read(int level, HDF5Restart::SerializeData& data);
+
+  std::unique_ptr<HDF5Restart> reader; //!< HDF5 data reader
+  std::future<bool> pending; //!< Pending background read
+  int pendingLevel = -1; //!< Level being read in the background
+  HDF5Restart::SerializeData buffer; //!< Data for the background read
+};
+
+
+//! \brief Adds the physical time to the data of a recorded HDF5 level.
+void setLevelTime(double time, HDF5Restart::SerializeData& data);
+
+//! \brief Returns the physical time of a recorded HDF5 level.
+//! \return NaN if the level has no time recorded
+double levelTime(const HDF5Restart::SerializeData& data);
+
+//! \brief Extracts the face pressures of a recorded HDF5 level.
+//! \return False if the level holds no pressures
+bool levelPressures(const HDF5Restart::SerializeData& data,
+                    std::vector<double>& values);
+
+
+/*!
+  \brief Resamples recorded coupling data in time.
+  \details The recorded levels are read in sequence into a lookahead
+  buffer, holding the levels neighbouring the requested time. Between two
+  levels the values are interpolated linearly, or with a cubic Hermite
+  spline using finite difference slopes over the neighbouring levels.
+  Requests before the first or after the last level use that level.
+*/
+
+class ReplayResampler
+{
+public:
+  //! \brief Interpolation schemes in time.
+  enum class Scheme { Linear, Cubic };
+
+  //! \brief Function reading a level, returns false past the last level.
+  using Source = std::function<bool(int level, double& time,
+                                    std::vector<double>& values)>;
+
+  //! \brief The constructor sets the level source.
+  //! \param source Function reading a level
+  //! \param scheme Interpolation scheme
+  //! \param first First level to use
+  ReplayResampler(Source source, Scheme scheme, int first = 1);
+
+  //! \brief Returns the values at a given time, or nullptr if no levels.
+  //! \details The returned values are valid until the next call.
+  //! Requests must be in non-decreasing time order.
+  const double* evaluate(double time);
+
+  //! \brief Returns the number of buffered levels.
+  size_t buffered() const { return window.size(); }
+
+private:
+  //! \brief Reads the next level into the buffer.
+  bool load();
+
+  //! \brief A buffered level.
+  struct Level {
+    double time; //!< Physical time of level
+    std::vector<double> values; //!< Values of level
+  };
+
+  Source source; //!< Function reading a level
+  Scheme scheme; //!< Interpolation scheme
+  int next; //!< Next level to read
+  bool atEnd = false; //!< True when all levels have been read
+  std::deque<Level> window; //!< Buffered consecutive levels
+  std::vector<double> result; //!< Interpolated values
+};
+
+}
+
+#endif
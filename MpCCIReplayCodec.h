@@ -0,0 +1,171 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MpCCIReplayCodec.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Compressed storage of recorded MpCCI coupling data.
+//!
+//==============================================================================
+
+#ifndef MPCCI_REPLAY_CODEC_H_
+#define MPCCI_REPLAY_CODEC_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace MpCCI {
+
+/*!
+  \brief Temporal delta encoding of coupling data levels.
+  \details Each level is encoded relative to the reconstruction of the
+  previous level, except at key levels which are encoded relative to zero.
+  Without a tolerance, the bit patterns of the values are XOR'ed with the
+  previous ones, split in byte planes and stored with run-length coding of
+  the zero bytes, which is lossless. Slowly varying data then have zero sign,
+  exponent and high mantissa bytes, typically saving two to three of the
+  eight bytes of each value, and values with short mantissas, e.g., rounded
+  or unchanged values, also save their zero low mantissa bytes.
+  With a tolerance, the differences are quantized to steps of
+  twice the tolerance and stored as variable length integers, such that
+  the reconstruction error of each value is bounded by the tolerance.
+*/
+
+class ReplayCodec
+{
+public:
+  //! \brief The constructor sets the tolerance.
+  //! \param tol Maximum reconstruction error, zero for lossless encoding
+  explicit ReplayCodec(double tol = 0.0) : tolerance(tol) {}
+
+  //! \brief Returns the maximum reconstruction error.
+  double getTolerance() const { return tolerance; }
+
+  //! \brief Encodes a level.
+  //! \param values Values to encode
+  //! \param prev Reconstruction of previous level, updated on return.
+  //! Empty for a key level.
+  //! \param out Encoded bytes, appended to
+  void encode(const std::vector<double>& values, std::vector<double>& prev,
+              std::string& out) const;
+
+  //! \brief Decodes a level.
+  //! \param data Encoded bytes
+  //! \param size Number of encoded bytes
+  //! \param n Number of values
+  //! \param values Reconstruction of previous level on input, empty for a
+  //! key level. The decoded values on output.
+  //! \return False if the data is corrupt
+  bool decode(const char* data, size_t size, size_t n,
+              std::vector<double>& values) const;
+
+private:
+  double tolerance; //!< Maximum reconstruction error
+};
+
+
+/*!
+  \brief Appends coupling data levels to a compressed replay file.
+  \details The file holds a fixed-size header followed by one block per
+  level, with its physical time and encoded values. A key level is stored
+  at regular intervals to bound the cost of random access. The level index
+  is appended when the file is closed. Levels written before the first
+  level holding data are stored as zeros, as for ReplayWriter.
+*/
+
+class CompressedReplayWriter
+{
+public:
+  //! \brief The constructor sets the file name and encoding.
+  //! \param file Name of file
+  //! \param tol Maximum reconstruction error, zero for lossless encoding
+  //! \param keyInterval Number of levels between key levels
+  explicit CompressedReplayWriter(const std::string& file, double tol = 0.0,
+                                  int keyInterval = 64);
+  //! \brief The destructor closes the file.
+  ~CompressedReplayWriter() { this->close(); }
+
+  //! \brief Appends a level to the file.
+  //! \param time Physical time of the level
+  //! \param values Values to write
+  //! \param size Number of values, must be the same for all non-empty levels
+  bool write(double time, const double* values, size_t size);
+
+  //! \brief Writes the level index and closes the file.
+  bool close();
+
+private:
+  //! \brief Encodes and appends a level block.
+  void append(double time, const std::vector<double>& values);
+
+  std::string fileName; //!< Name of file
+  std::ofstream os; //!< Output stream
+  ReplayCodec codec; //!< Level encoder
+  uint32_t interval; //!< Number of levels between key levels
+  uint64_t nValues = 0; //!< Number of values per level
+  std::vector<uint64_t> offsets; //!< File offset of each level block
+  std::vector<double> emptyTimes; //!< Times of levels before the file exists
+  std::vector<double> prev; //!< Reconstruction of previous level
+  std::string buffer; //!< Encoding buffer
+};
+
+
+/*!
+  \brief Memory mapped reader for compressed replay files.
+  \details The level blocks are located through the level index, which is
+  rebuilt by scanning the blocks for files that were not closed. The last
+  decoded level is kept, such that sequential reading decodes each level
+  only once.
+*/
+
+class CompressedReplayFile
+{
+public:
+  //! \brief Default constructor.
+  CompressedReplayFile() = default;
+  //! \brief No copying allowed.
+  CompressedReplayFile(const CompressedReplayFile&) = delete;
+  //! \brief The destructor unmaps the file.
+  ~CompressedReplayFile();
+
+  //! \brief Maps a compressed replay file.
+  //! \return False if the file is missing or not a valid replay file
+  bool open(const std::string& file);
+
+  //! \brief Returns the number of values per level.
+  size_t size() const { return nValues; }
+  //! \brief Returns the number of levels in the file.
+  int levels() const { return offsets.size(); }
+  //! \brief Returns the maximum reconstruction error of the file.
+  double tolerance() const { return codec.getTolerance(); }
+
+  //! \brief Returns the physical time of a level, NaN if out of range.
+  //! \param level 0-based level index
+  double time(int level) const;
+
+  //! \brief Decodes the values of a level.
+  //! \param level 0-based level index
+  //! \param values The decoded values
+  //! \return False if out of range or the data is corrupt
+  bool level(int level, std::vector<double>& values);
+
+private:
+  void* map = nullptr; //!< Start of the memory mapping
+  size_t mapSize = 0; //!< Size of the memory mapping
+  size_t nValues = 0; //!< Number of values per level
+  int interval = 1; //!< Number of levels between key levels
+  ReplayCodec codec; //!< Level decoder
+  std::vector<uint64_t> offsets; //!< File offset of each level block
+  int last = -1; //!< Last decoded level
+  std::vector<double> current; //!< Values of last decoded level
+};
+
+}
+
+#endif
@@ -0,0 +1,84 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MpCCISerialize.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Helpers for IFEM MpCCI coupled checkpoint buffers.
+//!
+//==============================================================================
+
+#ifndef MPCCI_SERIALIZE_H_
+#define MPCCI_SERIALIZE_H_
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace MpCCI {
+
+//! \brief Appends a size-prefixed vector to a checkpoint buffer.
+template<class T>
+void appendVector (std::string& str, const std::vector<T>& vec)
+{
+  const uint64_t n = vec.size();
+  str.append(reinterpret_cast<const char*>(&n), sizeof(n));
+  str.append(reinterpret_cast<const char*>(vec.data()), n*sizeof(T));
+}
+
+
+//! \brief Extracts a size-prefixed vector from a checkpoint buffer.
+template<class T>
+bool extractVector (const std::string& str, size_t& pos, std::vector<T>& vec)
+{
+  uint64_t n;
+  if (pos + sizeof(n) > str.size())
+    return false;
+  memcpy(&n, str.data() + pos, sizeof(n));
+  pos += sizeof(n);
+  if (n > (str.size() - pos) / sizeof(T))
+    return false;
+  vec.resize(n);
+  memcpy(vec.data(), str.data() + pos, n*sizeof(T));
+  pos += n*sizeof(T);
+  return true;
+}
+
+
+//! \brief Appends a container of vectors to a checkpoint buffer.
+template<class Container>
+void appendVectors (std::string& str, const Container& vecs)
+{
+  const uint64_t n = vecs.size();
+  str.append(reinterpret_cast<const char*>(&n), sizeof(n));
+  for (const auto& vec : vecs)
+    appendVector(str, vec);
+}
+
+
+//! \brief Extracts a container of vectors from a checkpoint buffer.
+template<class Container>
+bool extractVectors (const std::string& str, size_t& pos, Container& vecs)
+{
+  uint64_t n;
+  if (pos + sizeof(n) > str.size())
+    return false;
+  memcpy(&n, str.data() + pos, sizeof(n));
+  pos += sizeof(n);
+  if (n > (str.size() - pos) / sizeof(n))
+    return false;
+  vecs.clear();
+  vecs.resize(n);
+  for (auto& vec : vecs)
+    if (!extractVector(str, pos, vec))
+      return false;
+  return true;
+}
+
+}
+
+#endif
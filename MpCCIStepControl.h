@@ -0,0 +1,114 @@
+// $Id$
+//==============================================================================
+//!
+//! \file MpCCIStepControl.h
+//!
+//! \date Oct 17 2026
+//!
+//! \author agent
+//!
+//! \brief Structural subcycling and step size control for IFEM MpCCI.
+//!
+//==============================================================================
+
+#ifndef MPCCI_STEP_CONTROL_H_
+#define MPCCI_STEP_CONTROL_H_
+
+#include <string>
+#include <vector>
+
+namespace tinyxml2 { class XMLElement; }
+
+namespace MpCCI {
+
+/*!
+  \brief Controls the structural substeps within a coupling window.
+  \details With fixed subcycling each coupling window is split in a given
+  number of structural steps. With adaptive control the preferred structural
+  step size is estimated from the deviation between the displacements and a
+  linear extrapolation of the previous steps, and from the number of
+  nonlinear iterations. The number of substeps is then chosen to fit the
+  preferred step size within the coupling window, and the preferred step
+  size is proposed to the coupling server.
+*/
+
+class StepControl
+{
+public:
+  //! \brief Parses the subcycling settings from an XML element.
+  //! \details Recognized attributes are \a steps (fixed number of substeps),
+  //! \a adaptive (true to estimate the step size), \a tol (relative error
+  //! tolerance), \a minSteps and \a maxSteps (limits on the number of
+  //! substeps), \a growth (maximum change in step size per window),
+  //! \a targetIter (preferred number of nonlinear iterations) and
+  //! \a minDt and \a maxDt (limits on the proposed step size).
+  void parse(const tinyxml2::XMLElement* elem);
+
+  //! \brief Returns true if step size estimation is enabled.
+  bool adaptive() const { return isAdaptive; }
+
+  //! \brief Returns the number of substeps to use for a coupling window.
+  //! \param window Size of the coupling window
+  int substeps(double window) const;
+
+  //! \brief Returns the preferred structural step size.
+  //! \param window Size of the current coupling window
+  double stepSize(double window) const;
+
+  //! \brief Returns the proposed coupling window size.
+  //! \details This is the window fitting the smallest number of substeps.
+  //! \param window Size of the current coupling window
+  double proposal(double window) const { return minSteps*this->stepSize(window); }
+
+  //! \brief Starts the substeps of a coupling window.
+  //! \details Resets the displacement history to the last accepted window.
+  void beginWindow();
+
+  //! \brief Estimates the relative error of a structural substep.
+  //! \param u Displacements at the end of the substep
+  //! \param dt Size of the substep
+  //! \return Relative deviation from the extrapolated displacements
+  double estimate(const std::vector<double>& u, double dt);
+
+  //! \brief Accepts the substeps of a coupling window.
+  //! \param error Largest estimated error in the window
+  //! \param iters Largest number of nonlinear iterations in the window
+  //! \param dt Size of the substeps in the window
+  void accept(double error, int iters, double dt);
+
+  //! \brief Appends the preferred step size and the accepted displacement
+  //! history to a checkpoint buffer.
+  void serialize(std::string& str) const;
+  //! \brief Restores the preferred step size and the accepted displacement
+  //! history from a checkpoint buffer.
+  //! \param str The checkpoint buffer
+  //! \param pos Position in \a str, advanced past the step control state
+  bool deSerialize(const std::string& str, size_t& pos);
+
+private:
+  //! \brief Displacement history for the extrapolation.
+  struct History {
+    std::vector<double> u0; //!< Displacements at previous step
+    std::vector<double> u1; //!< Displacements at the step before
+    double dt = 0.0; //!< Size of the previous step
+    int levels = 0; //!< Number of valid levels
+  };
+
+  int nSteps = 1; //!< Fixed number of substeps
+  bool isAdaptive = false; //!< True to estimate the step size
+  double tol = 1.0e-3; //!< Relative error tolerance
+  int minSteps = 1; //!< Smallest number of substeps
+  int maxSteps = 16; //!< Largest number of substeps
+  double growth = 2.0; //!< Largest change in step size per window
+  int targetIter = 5; //!< Preferred number of nonlinear iterations
+  double minDt = 0.0; //!< Smallest proposed step size
+  double maxDt = 0.0; //!< Largest proposed step size, 0 for no limit
+  double preferred = 0.0; //!< Preferred structural step size
+
+  History accepted; //!< History at the end of the last accepted window
+  History current; //!< History within the current window
+};
+
+}
+
+#endif
@@ -15,8 +15,13 @@
 #define _SIM_MPCCI_STRUCTURE_H_
 
 #include "HDF5Restart.h"
+#include "MpCCIAccelerator.h"
 #include "MpCCIDataHandler.h"
 #include "MpCCIArgs.h"
+#include "MpCCIInterfacePlan.h"
+#include "MpCCIPredictor.h"
+#include "MpCCIFollowerPressure.h"
+#include "MpCCIPressureOperator.h"
 #include "SIMElasticityWrap.h"
 
 class IntegrandBase;
@@ -25,6 +30,7 @@ class IntegrandBase;
 namespace MpCCI {
 
 struct MeshInfo;
+class PressureLoad;
 
 /*!
   \brief Driver wrapping the elasticity solver with MpCCI data transfer functions.
@@ -40,9 +46,33 @@ public:
   //! \brief Empty destructor.
   virtual ~SIMStructure() = default;
 
+  using SIMElasticityWrap<Dim>::parse;
+  //! \brief Parses a data section from an XML element.
+  bool parse(const tinyxml2::XMLElement* elem) override;
+
   //! \brief Computes the solution for the current time step.
   bool solveStep(TimeStep& tp) override;
 
+  using SIMElasticityWrap<Dim>::assembleSystem;
+  //! \brief Administers assembly of the linear equation system.
+  //! \details If factorization reuse is enabled, the left-hand-side matrix
+  //! is only assembled once and subsequent calls assemble the RHS only.
+  //! With follower pressures, the current displacements in \a prevSol
+  //! are used for the deformed coupling surface.
+  bool assembleSystem(const TimeDomain& time, const Vectors& prevSol,
+                      bool newLHSmatrix, bool poorConvg) override;
+
+  using SIMElasticityWrap<Dim>::solveSystem;
+  //! \brief Solves the assembled linear system of equations.
+  bool solveSystem(Vector& solution, int printSol, double* rCond,
+                   const char* compName, size_t idxRHS) override;
+
+  //! \brief Prints and resets the assembly and solve times for current step.
+  void printStepTimings(std::ostream& os);
+
+  //! \brief Forces a re-assembly of the left-hand-side matrix.
+  void resetLHS() { haveLHS = false; }
+
   //! \brief Returns the actual integrand.
   Elasticity* getIntegrand() override;
 
@@ -52,28 +82,213 @@ public:
   //! \brief Write data to MpCCI server.
   void writeData(int quant_id, const MeshInfo& info, double* data) const override;
 
+  //! \brief Returns true if displacements are written instead of positions.
+  bool sendsDisplacements() const override { return sendDisplacements; }
+
   //! \brief Adds the pressure load function.
-  bool addCoupling(std::string_view name, const MeshInfo& info) override;
+  bool addCoupling(const std::vector<std::string>& names,
+                   const MeshInfo& info) override;
+
+  //! \brief Returns the interface nodal forces received from MpCCI.
+  //! \details The forces are aligned with MeshInfo::nodes.
+  const std::vector<double>& getLoads() const { return nodeForces; }
+
+  //! \brief Returns the coupling mesh info, or nullptr if not coupled.
+  const MeshInfo* getCouplingInfo() const { return couplingInfo; }
 
-  //! \brief Returns a const reference to configured loads.
-  const std::map<int, Vec3>& getLoads() const { return loadMap; }
+  //! \brief Extracts the interface state for interface output.
+  //! \details The state holds the nodal displacements, the face pressures
+  //! and the nodal forces, with three components per node also in 2D.
+  //! In partitioned runs this is collective, and the state is empty
+  //! on other ranks than 0.
+  void getInterfaceState(std::vector<double>& state);
 
   //! \brief Serializes received pressure loads from MpCCI.
   void serializeMpCCIData(HDF5Restart::SerializeData& data) const override;
 
+  //! \brief Serializes a snapshot of pressure loads.
+  static void serializePressures(const std::vector<double>& pressures,
+                                 HDF5Restart::SerializeData& data);
+
   //! \brief Deserializes received pressure loads from MpCCI.
   void deserializeMpCCIData(const HDF5Restart::SerializeData& data) override;
 
+  //! \brief Serializes the coupling state for a coupled checkpoint.
+  //! \details Includes the pressures and forces in use, the start of the
+  //! coupling window, the interface displacements to send next, the
+  //! accelerator history and the predictor time levels.
+  bool serializeCoupling(HDF5Restart::SerializeData& data) const;
+
+  //! \brief Restores the coupling state from a coupled checkpoint.
+  //! \details The coupling must have been added first.
+  bool deSerializeCoupling(const HDF5Restart::SerializeData& data);
+
+  //! \brief Uses externally stored pressures without copying.
+  //! \details Passing nullptr reverts to the internally stored pressures.
+  void setMpCCIData(const double* data, size_t size) override;
+
+  //! \brief Returns the internally stored face pressures.
+  const std::vector<double>& getPressures() const { return elemPressures; }
+
   //! \brief Broadcast data to non-root processes.
   void broadcast(int& status) override;
 
+  //! \brief Gather interface displacements on the root process.
+  void gather() override;
+
+  //! \brief Returns the maximum number of coupling iterations per time step.
+  //! \details A value larger than one enables implicit coupling.
+  int maxCouplingIterations() const { return maxCouplingIt; }
+
+  //! \brief Starts the coupling iterations of a new time step.
+  void beginCouplingStep();
+
+  //! \brief Establishes the interface displacements for the next iteration.
+  //! \param last True if this is the last allowed iteration of the step
+  //! \return True if the interface residual has converged
+  bool accelerate(bool last = false);
+
+  //! \brief Returns the interface accelerator.
+  const Accelerator& getAccelerator() const { return accelerator; }
+
+  //! \brief Returns true if the parallel (Jacobi) coupling scheme is used.
+  bool parallelCoupling() const { return parallel; }
+  //! \brief Returns true if parallel coupling steps are corrected.
+  bool parallelCorrector() const { return corrector; }
+
+  //! \brief Records the loads just received and extrapolates them.
+  //! \details The extrapolated loads are used until restoreLoads() is called.
+  //! \param t Time the received loads belong to
+  //! \param tNext Time to extrapolate the loads to
+  void predictLoads(double t, double tNext);
+
+  //! \brief Reverts to the loads last received.
+  //! \param correct If true, the coupling window is also reset to where
+  //! it was when the loads were extrapolated, to solve the step again
+  void restoreLoads(bool correct = false);
+
+  //! \brief Records the interface displacements and sends extrapolated ones.
+  //! \param t Time of the current solution
+  //! \param tNext Time to extrapolate the interface displacements to
+  void predictDisplacements(double t, double tNext);
+
+  //! \brief Starts a coupling window with the pressures just received.
+  //! \details The pressures at the start of the window are those accepted
+  //! at the end of the previous window.
+  void beginLoadWindow();
+
+  //! \brief Interpolates the pressures linearly across the coupling window.
+  //! \param theta Relative position within the window, in (0,1]
+  void interpolateLoads(double theta);
+
+  //! \brief Ends a coupling window, keeping its final pressures.
+  void endLoadWindow();
+
+  //! \brief Projects the coupling loads and interface motion onto modes.
+  //! \details Only valid for the linear formulation.
+  //! \param modes Mass-normalized eigenvectors, DOF-based
+  //! \param eqModes The same eigenvectors, equation-based
+  bool setModalBasis(const std::vector<Vector>& modes,
+                     const std::vector<Vector>& eqModes);
+
+  //! \brief Computes the modal loads from the current coupling data.
+  //! \param f Load for each mode
+  void getModalLoads(std::vector<double>& f) const;
+
+  //! \brief Reconstructs the interface displacements from modal coordinates.
+  //! \details Only the coupling nodes are evaluated.
+  void setModalSolution(const std::vector<double>& q);
+
 protected:
   //! \brief Assemble the nodal interface forces from the fluid solver.
+  //! \details Follower pressures and their load stiffness are also added.
   bool assembleDiscreteTerms(const IntegrandBase*, const TimeDomain&) override;
 
-  std::map<int, Vec3> loadMap; //!< Map of boundary forces
+  //! \brief Resolves the equation numbers for the interface nodal forces.
+  void setupForceEqns(const MeshInfo& info);
+
+  //! \brief Establishes the solution vector indices for the interface nodes.
+  void getInterfaceDofs(const MeshInfo& info, IntVec& dofs) const;
+
+  //! \brief Returns the interface forces currently in use.
+  //! \details In partitioned runs this is only valid on rank 0.
+  const double* forceData() const
+  {
+    return usePredicted ? predictedForces.data() : nodeForces.data();
+  }
+
+  //! \brief Extracts the interface displacements from the current solution.
+  //! \details In partitioned runs the values are only available on rank 0.
+  void getInterfaceDisplacements(std::vector<double>& u);
+
+  //! \brief Returns the face pressures currently in use.
+  const double* pressureData() const
+  {
+    return extPressures ? extPressures : elemPressures.data();
+  }
+
+  std::vector<double> nodeForces; //!< Interface forces aligned with MeshInfo::nodes
+  std::vector<double> ownedForces; //!< Forces for owned interface nodes
+  std::vector<int> forceNodes; //!< Interface nodes to assemble forces for
+  std::vector<int> forceEqns; //!< Equation numbers for the interface forces
+  std::vector<int> mpcNodes; //!< Entries in \a forceNodes with constrained DOFs
+  bool haveForces = false; //!< True if interface forces have been received
   std::vector<double> elemPressures; //!< Element pressure values
-  MpCCIArgs::Formulation form;
+  const double* extPressures = nullptr; //!< Externally stored pressure values
+  PressureLoad* pressureLoad = nullptr; //!< Pressure load function
+  const double* windowEnd = nullptr; //!< Pressures at end of coupling window
+  std::vector<double> windowStart; //!< Pressures at start of coupling window
+  std::vector<double> windowLoads; //!< Interpolated pressures within window
+  MpCCIArgs::Formulation form; //!< Elasticity formulation
+  bool useLoadOperator = false; //!< Use precomputed pressure load operator
+  PressureOperator pressureOp; //!< Precomputed pressure load operator
+  bool useFollower = false; //!< Apply pressures on the deformed surface
+  FollowerPressure follower; //!< Follower pressure loads and load stiffness
+  const Vector* followerDisp = nullptr; //!< Displacements being assembled for
+  bool followerLHS = false; //!< True if the Newton matrix is being assembled
+
+  const MeshInfo* couplingInfo = nullptr; //!< Coupling mesh info
+  InterfacePlan plan; //!< Communication plan for partitioned coupling data
+  std::vector<double> interfaceDisp; //!< Gathered interface displacements
+  std::vector<double> sendBuffer; //!< Buffer for owned interface values
+  IntVec interfaceDofs; //!< Solution vector indices for the interface nodes
+  bool sendDisplacements = false; //!< Send displacements instead of positions
+
+  Accelerator accelerator; //!< Interface accelerator for implicit coupling
+  int maxCouplingIt = 1; //!< Maximum number of coupling iterations per step
+  std::vector<double> relaxedDisp; //!< Accelerated or extrapolated interface displacements
+  bool useRelaxed = false; //!< True to send \a relaxedDisp
+
+  bool parallel = false; //!< True for parallel (Jacobi) coupling
+  bool corrector = false; //!< True to correct parallel steps with actual loads
+  Predictor dispPredictor; //!< Extrapolates the interface displacements
+  Predictor pressurePredictor; //!< Extrapolates the face pressures
+  Predictor forcePredictor; //!< Extrapolates the interface forces
+  std::vector<double> predictedPressures; //!< Extrapolated face pressures
+  std::vector<double> predictedForces; //!< Extrapolated interface forces
+  bool usePredicted = false; //!< True when extrapolated forces are in use
+  const double* receivedPressures = nullptr; //!< Pressures last received
+  std::vector<double> predictedStart; //!< Window start when extrapolating
+
+  std::vector<double> modalPressure; //!< Modal loads per face pressure
+  std::vector<double> modalShapes; //!< Mode shapes at the interface nodes
+  std::vector<double> modalDisp; //!< Interface displacements from modes
+  bool useModal = false; //!< True if the solution is given in modal form
+
+  bool reuseLHS = false; //!< Reuse factorized LHS matrix between steps
+  bool haveLHS = false; //!< True if a reusable LHS matrix has been assembled
+  double lhsDt = 0.0; //!< Time step size the LHS matrix was assembled for
+  int lhsMode = -1; //!< Solution mode the LHS matrix was assembled for
+
+  //! \brief Assembly and solve timings for a step.
+  struct StepTimings {
+    bool print = false; //!< True to print the timings for each step
+    double assembly = 0.0; //!< Wall time spent in assembly
+    double solve = 0.0; //!< Wall time spent in the linear solver
+    int nAssembly = 0; //!< Number of assemblies
+    int nLHS = 0; //!< Number of assemblies including the LHS matrix
+    int nSolve = 0; //!< Number of linear solves
+  } timings; //!< Timings for the current step
 };
 
 }
@@ -18,6 +18,13 @@
 #include "SIMSolver.h"
 #include "MpCCIMockJob.h"
 #include "MpCCIJob.h"
+#include "MpCCIInterfaceOutput.h"
+#include "MpCCIMetrics.h"
+#include "MpCCIModalSIM.h"
+#include "MpCCIReplay.h"
+#include "MpCCIReplayCodec.h"
+#include "MpCCISerialize.h"
+#include "MpCCIStepControl.h"
 #include "Utilities.h"
 
 
@@ -101,7 +108,8 @@ private:
 */
 
 template<class T1, class Newmark = NewmarkSIM, class Job = MpCCI::Job>
-class SIMSolver : public ::SIMSolver<T1>
+class SIMSolver : public ::SIMSolver<T1>,
+                  public MpCCI::GlobalHandler
 {
 public:
   //! \brief The constructor forwards to the parent class constructor.
@@ -113,11 +121,70 @@ public:
     if (!strcasecmp(elem->Value(), "mpcci"))  {
       const tinyxml2::XMLElement* child = elem->FirstChildElement();
       for (; child; child = child->NextSiblingElement())
-        if (!strcasecmp(child->Value(),"saveData"))
-          mpcciSerializer = std::make_unique<HDF5Restart>(couplingFile,
-                                                          this->S1.getProcessAdm());
+        if (!strcasecmp(child->Value(),"saveData")) {
+          std::string format;
+          utl::getAttribute(child, "format", format);
+          utl::getAttribute(child, "queue", queueDepth);
+          if (queueDepth < 1) {
+            IFEM::cout << "  ** Invalid coupling data queue depth "
+                       << queueDepth << ", must be at least 1." << std::endl;
+            return false;
+          }
+          // The replay files are written by the client rank only,
+          // which holds the face pressures of the whole coupling mesh
+          const bool client = this->S1.getProcessAdm().getProcId() == 0;
+          if (format == "binary") {
+            if (client)
+              replayWriter = std::make_unique<MpCCI::ReplayWriter>(couplingFile + ".bin");
+          }
+          else if (format == "compressed") {
+            double tol = 0.0;
+            int keyInterval = 64;
+            utl::getAttribute(child, "tolerance", tol);
+            utl::getAttribute(child, "keyInterval", keyInterval);
+            if (client)
+              compressedWriter = std::make_unique<MpCCI::CompressedReplayWriter>(
+                                   couplingFile + ".rpz", tol, keyInterval);
+          }
+          else
+            mpcciSerializer = std::make_unique<HDF5Restart>(couplingFile,
+                                                            this->S1.getProcessAdm());
+        }
         else if (!strcasecmp(child->Value(),"couplingSet"))
-          couplingSet = utl::getValue(child, "couplingSet");
+          couplingSets.push_back(utl::getValue(child, "couplingSet"));
+        else if (!strcasecmp(child->Value(),"meshCache"))
+          useMeshCache = true;
+        else if (!strcasecmp(child->Value(),"replay")) {
+          std::string scheme;
+          utl::getAttribute(child, "interpolation", scheme, true);
+          if (scheme == "cubic")
+            replayScheme = MpCCI::ReplayResampler::Scheme::Cubic;
+          else if (scheme == "linear")
+            replayScheme = MpCCI::ReplayResampler::Scheme::Linear;
+        }
+        else if (!strcasecmp(child->Value(),"slab"))
+          utl::getAttribute(child, "thickness", slabThickness);
+        else if (!strcasecmp(child->Value(),"checkpoint"))
+          utl::getAttribute(child, "interval", checkpointInterval);
+        else if (!strcasecmp(child->Value(),"restart")) {
+          restart = true;
+          utl::getAttribute(child, "level", restartLevel);
+        }
+        else if (!strcasecmp(child->Value(),"subcycle"))
+          stepControl.parse(child);
+        else if (!strcasecmp(child->Value(),"metrics")) {
+          metricsFile = couplingFile;
+          metricsFile.replace(metricsFile.find("_mpcci_data"),
+                              std::string::npos, "_mpcci_metrics.jsonl");
+          utl::getAttribute(child, "file", metricsFile);
+        }
+        else if (!strcasecmp(child->Value(),"interfaceOutput")) {
+          interfaceFile = couplingFile;
+          interfaceFile.replace(interfaceFile.find("_mpcci_data"),
+                                std::string::npos, "_mpcci_interface.bin");
+          utl::getAttribute(child, "file", interfaceFile);
+          utl::getAttribute(child, "volumeInterval", volumeInterval);
+        }
 
       return true;
     }
@@ -137,10 +204,16 @@ public:
     couplingFile.erase(couplingFile.find_last_of("."));
     couplingFile += "_mpcci_data";
 
+    checkpointFile = couplingFile;
+    checkpointFile.replace(checkpointFile.find("_mpcci_data"),
+                           std::string::npos, "_mpcci_restart");
+
     Newmark nSim(this->S1);
     if (!nSim.read(infile) || !this->read(infile))
       return 2;
 
+    this->startDataWriter();
+
     if (!this->S1.preprocess())
       return 3;
 
@@ -161,12 +234,61 @@ public:
     if (!this->saveState(geoBlk,nBlock,true,infile,this->tp.multiSteps()))
       return 2;
 
-    Job job(this->S1, this->tp.time.dt, &this->S1, nullptr);
+    std::string meshCache;
+    if (useMeshCache) {
+      meshCache = infile;
+      meshCache = meshCache.substr(0,meshCache.find_last_of('.'));
+      meshCache += "_mpcci_mesh.bin";
+    }
+
+    // The time integration state is restored before connecting,
+    // such that the coupling starts at the time of the checkpoint
+    HDF5Restart::SerializeData restartData;
+    if (restart && !this->readCheckpoint(nSim, restartData))
+      return 2;
+
+    if constexpr (!std::is_base_of_v<MpCCI::MockJob, Job>) {
+      MpCCI::Job::meshCache = meshCache;
+      MpCCI::Job::slabThickness = slabThickness;
+      MpCCI::Job::startTime = this->tp.time.t;
+    }
 
-    if constexpr (std::is_same_v<Job, MpCCI::MockJob>) {
-      job.setInputFile(couplingFile, couplingSet, this->S1);
+    Job job(this->S1, this->tp.time.dt, &this->S1, this);
+
+    if constexpr (std::is_base_of_v<MpCCI::MockJob, Job>) {
+      job.setInputFile(couplingFile, couplingSets, this->S1, meshCache,
+                       replayScheme);
+      dataWriter.reset();
       mpcciSerializer.reset();
+      replayWriter.reset();
+      compressedWriter.reset();
+      if (restart)
+        job.setStep(this->tp.step);
+    }
+
+    // The coupling state needs the coupling established by the job
+    if (restart && !this->S1.deSerializeCoupling(restartData)) {
+      IFEM::cout << "  ** Checkpoint does not match the coupling mesh."
+                 << std::endl;
+      return 2;
+    }
+
+    if (checkpointInterval > 0)
+      checkpointer = std::make_unique<HDF5Restart>(checkpointFile,
+                                                   this->S1.getProcessAdm());
+
+    if (!interfaceFile.empty() && !this->startInterfaceWriter())
+      return 2;
+
+    MpCCI::Metrics metrics;
+    if (!metricsFile.empty() && this->S1.getProcessAdm().getProcId() == 0) {
+      if (metrics.open(metricsFile))
+        job.setMetrics(&metrics);
+      else
+        IFEM::cout << "  ** Failed to open metrics file " << metricsFile
+                   << std::endl;
     }
+    MpCCI::Metrics* pm = metrics.active() ? &metrics : nullptr;
 
     this->printHeading(heading);
 
@@ -174,26 +296,138 @@ public:
     int status = MPCCI_CONV_STATE_CONVERGED;
     this->S1.initLHSbuffers();
 
-    while (((status = job.transfer(status, this->tp.time)) == MPCCI_CONV_STATE_CONTINUE ||
-            status == MPCCI_CONV_STATE_CONVERGED) && this->advanceStep()) {
+    const bool parallel = this->S1.parallelCoupling();
+    const bool correct = parallel && this->S1.parallelCorrector();
+    int maxIter = this->S1.maxCouplingIterations();
+    if (parallel && maxIter > 1) {
+      IFEM::cout << "  ** Implicit coupling is not used with parallel coupling."
+                 << std::endl;
+      maxIter = 1;
+    }
+
+    // With the parallel coupling corrector, a step is solved again once the
+    // loads at its end have been received, and its results saved thereafter
+    HDF5Restart::SerializeData prevState;
+    int prevSub = 0;
+
+    while ((status = job.transfer(status, this->tp.time)) == MPCCI_CONV_STATE_CONTINUE ||
+           status == MPCCI_CONV_STATE_CONVERGED) {
+      if (prevSub > 0) {
+        if (!this->correctStep(nSim, prevState, prevSub, pm)) {
+          job.transfer(MPCCI_CONV_STATE_DIVERGED, this->tp.time);
+          return 3;
+        }
+        if (!this->saveStep(nSim, geoBlk, nBlock, pm)) {
+          job.transfer(MPCCI_CONV_STATE_DIVERGED, this->tp.time);
+          return 4;
+        }
+        prevSub = 0;
+      }
+
+      this->setWindowSize();
+      if (!this->advanceStep())
+        break;
       nSim.advanceStep(this->tp, false);
-      if (nSim.solveStep(this->tp) != SIM::CONVERGED) {
-        job.transfer(MPCCI_CONV_STATE_DIVERGED, this->tp.time);
-        return 3;
+
+      // In implicit coupling the time integration state is
+      // rolled back before each additional structural solve
+      HDF5Restart::SerializeData state;
+      if (maxIter > 1 || correct) {
+        if (!nSim.serialize(state))
+          return 3;
+        if (maxIter > 1)
+          this->S1.beginCouplingStep();
       }
-      this->S1.setSolution(nSim.getSolution(), 0);
 
-      if (!this->saveState(geoBlk,nBlock)) {
+      // In parallel coupling the step is solved with loads extrapolated
+      // from those received, while the other codes solve the same step
+      if (parallel)
+        this->S1.predictLoads(this->tp.time.t - this->tp.time.dt,
+                              this->tp.time.t);
+
+      const int nSub = stepControl.substeps(this->tp.time.dt);
+      double error = 0.0;
+      int nIter = 0;
+      for (int iter = 0; iter < maxIter; ++iter) {
+        if (iter > 0) {
+          status = job.transfer(MPCCI_CONV_STATE_CONTINUE, this->tp.time, iter);
+          if (status != MPCCI_CONV_STATE_CONTINUE &&
+              status != MPCCI_CONV_STATE_CONVERGED)
+            break;
+          if (!nSim.deSerialize(state))
+            return 3;
+        }
+
+        if (!this->solveWindow(nSim, nSub, error, nIter, pm)) {
+          job.transfer(MPCCI_CONV_STATE_DIVERGED, this->tp.time);
+          return 3;
+        }
+        this->S1.printStepTimings(IFEM::cout);
+
+        if (maxIter > 1) {
+          const bool converged = this->S1.accelerate(iter+1 == maxIter);
+          const MpCCI::Accelerator& acc = this->S1.getAccelerator();
+          IFEM::cout << "  Coupling iteration " << iter+1 << ": |r| = "
+                     << acc.residual() << " (relative " << acc.relResidual()
+                     << ")";
+          if (!converged && iter+1 < maxIter)
+            IFEM::cout << ", omega = " << acc.relaxation();
+          IFEM::cout << std::endl;
+          metrics.setIterations(iter+1);
+          if (!converged && iter+1 == maxIter)
+            IFEM::cout << "  ** Coupling iterations did not converge in "
+                       << maxIter << " iterations, continuing." << std::endl;
+          if (converged || iter+1 == maxIter) {
+            status = MPCCI_CONV_STATE_CONVERGED;
+            break;
+          }
+        }
+      }
+      if (status != MPCCI_CONV_STATE_CONTINUE &&
+          status != MPCCI_CONV_STATE_CONVERGED)
+        break;
+
+      this->S1.endLoadWindow();
+      stepControl.accept(error, nIter, this->tp.time.dt / nSub);
+      if (stepControl.adaptive())
+        IFEM::cout << "  Coupling window " << this->tp.time.dt << ": "
+                   << nSub << " substeps, estimated error " << error
+                   << ", preferred step "
+                   << stepControl.stepSize(this->tp.time.dt) << std::endl;
+
+      if (parallel) {
+        this->S1.restoreLoads();
+        this->S1.predictDisplacements(this->tp.time.t,
+                                      this->tp.time.t + this->tp.time.dt);
+      }
+
+      if (correct) {
+        prevState.swap(state);
+        prevSub = nSub;
+      }
+      else if (!this->saveStep(nSim, geoBlk, nBlock, pm)) {
         job.transfer(MPCCI_CONV_STATE_DIVERGED, this->tp.time);
         return 4;
       }
+      metrics.endStep(this->tp.step, this->tp.time.t, status);
 
       IFEM::pollControllerFifo();
       if (this->tp.time.t == this->tp.stopTime)
         break;
     }
 
+    // The last step is saved without correction
+    if (prevSub > 0 && !this->saveStep(nSim, geoBlk, nBlock, pm))
+      return 4;
+
     job.done();
+    if (dataWriter && !dataWriter->flush())
+      return 4;
+    if (compressedWriter && !compressedWriter->close())
+      return 4;
+    if (interfaceQueue && !interfaceQueue->flush())
+      return 4;
+
     return 0;
   }
 
@@ -201,20 +435,308 @@ public:
   bool saveState(int& geoBlk, int& nBlock, bool newMesh = false,
                  char* infile = nullptr, bool saveRes = true)
   {
-    if (mpcciSerializer) {
-      HDF5Restart::SerializeData data;
-      this->S1.serializeMpCCIData(data);
-      this->mpcciSerializer->writeData(data);
+    // The snapshot is written on the I/O thread.
+    // This must not be done while holding the HDF5 mutex.
+    if (dataWriter) {
+      const std::vector<double>& p = this->S1.getPressures();
+      dataWriter->push(this->tp.time.t, p.data(), p.size());
     }
 
+    // The interface is written every step, the volume every volumeInterval step
+    if (!interfaceFile.empty() && !newMesh) {
+      this->S1.getInterfaceState(interfaceState);
+      if (interfaceQueue)
+        interfaceQueue->push(this->tp.time.t, interfaceState.data(),
+                             interfaceState.size());
+      if (volumeInterval > 1 && this->tp.step % volumeInterval != 0)
+        return true;
+    }
+
+    // Replay data may be read on a background thread
+    std::lock_guard<std::mutex> lock(MpCCI::hdf5Mutex());
     return this->::SIMSolver<T1>::saveState(geoBlk, nBlock,
                                             newMesh, infile, saveRes);
   }
 
+  //! \brief Reads global data from the MpCCI server.
+  //! \details The time step size received is used for the next window.
+  void readGlobal(int quant_id, const double* data) override
+  {
+    if (quant_id == MPCCI_QID_TIMESTEP_SIZE)
+      serverDt = *data;
+  }
+
+  //! \brief Writes global data to the MpCCI server.
+  //! \details With adaptive subcycling the structural preferred
+  //! step size is proposed as the coupling time step size.
+  void writeGlobal(int quant_id, double* data) const override
+  {
+    if (quant_id == MPCCI_QID_PHYSICAL_TIME)
+      *data = this->tp.time.t;
+    else if (quant_id == MPCCI_QID_TIMESTEP_SIZE)
+      *data = stepControl.adaptive() ?
+              stepControl.proposal(this->tp.time.dt) : this->tp.time.dt;
+  }
+
 protected:
+  //! True if the structure is integrated by modal superposition
+  static constexpr bool modal = std::is_same_v<Newmark, MpCCI::ModalSIM<T1>>;
+
+  //! \brief Applies the time step size received from the server.
+  void setWindowSize()
+  {
+#if HAVE_MPI
+    if (this->S1.getProcessAdm().getNoProcs() > 1)
+      MPI_Bcast(&serverDt, 1, MPI_DOUBLE, 0,
+                *this->S1.getProcessAdm().getCommunicator());
+#endif
+    if (serverDt > 0.0)
+      this->tp.time.dt = serverDt;
+    serverDt = 0.0;
+  }
+
+  //! \brief Solves the structural substeps of a coupling window.
+  //! \details The pressures are interpolated linearly across the window.
+  //! \param nSim Time integrator, already advanced to the first substep
+  //! \param nSub Number of substeps
+  //! \param error Largest estimated error in the window
+  //! \param nIter Largest number of nonlinear iterations in the window
+  //! \param pm Metrics to record the solve time in, may be nullptr
+  bool solveWindow(Newmark& nSim, int nSub, double& error, int& nIter,
+                   MpCCI::Metrics* pm)
+  {
+    const double tEnd = this->tp.time.t;
+    const double window = this->tp.time.dt;
+    this->S1.beginLoadWindow();
+    stepControl.beginWindow();
+    error = 0.0;
+    nIter = 0;
+
+    for (int sub = 1; sub <= nSub; ++sub) {
+      if (nSub > 1) {
+        this->tp.time.dt = window / nSub;
+        this->tp.time.t = sub == nSub ? tEnd : tEnd - window + sub*this->tp.time.dt;
+        if (sub > 1)
+          nSim.advanceStep(this->tp, false);
+        this->S1.interpolateLoads(static_cast<double>(sub) / nSub);
+      }
+
+      {
+        MpCCI::Metrics::Scope timer(pm, MpCCI::Metrics::SOLVE);
+        if (nSim.solveStep(this->tp) != SIM::CONVERGED)
+          return false;
+      }
+      // The modal solver only reconstructs the interface displacements
+      if constexpr (!modal)
+        this->S1.setSolution(nSim.getSolution(), 0);
+
+      nIter = std::max(nIter, this->tp.iter);
+      if (stepControl.adaptive()) {
+        double err;
+        if constexpr (modal)
+          err = stepControl.estimate(nSim.getModalSolution(), this->tp.time.dt);
+        else
+          err = stepControl.estimate(nSim.getSolution(), this->tp.time.dt);
+#if HAVE_MPI
+        if (this->S1.getProcessAdm().getNoProcs() > 1)
+          MPI_Allreduce(MPI_IN_PLACE, &err, 1, MPI_DOUBLE, MPI_MAX,
+                        *this->S1.getProcessAdm().getCommunicator());
+#endif
+        error = std::max(error, err);
+      }
+    }
+
+    this->tp.time.t = tEnd;
+    this->tp.time.dt = window;
+    return true;
+  }
+
+  //! \brief Solves the previous step again with the loads received at its end.
+  //! \param nSim Time integrator
+  //! \param state Time integration state at the start of the step
+  //! \param nSub Number of substeps
+  //! \param pm Metrics to record the solve time in, may be nullptr
+  bool correctStep(Newmark& nSim, const HDF5Restart::SerializeData& state,
+                   int nSub, MpCCI::Metrics* pm)
+  {
+    this->S1.restoreLoads(true);
+    if (!nSim.deSerialize(state))
+      return false;
+
+    IFEM::cout << "  Correcting step " << this->tp.step
+               << " with the received loads" << std::endl;
+    double error;
+    int nIter;
+    if (!this->solveWindow(nSim, nSub, error, nIter, pm))
+      return false;
+    this->S1.printStepTimings(IFEM::cout);
+
+    this->S1.endLoadWindow();
+    this->S1.predictDisplacements(this->tp.time.t,
+                                  this->tp.time.t + this->tp.time.dt);
+    return true;
+  }
+
+  //! \brief Saves the results of the current step.
+  //! \details A coupled checkpoint is also written at the given interval.
+  bool saveStep(Newmark& nSim, int& geoBlk, int& nBlock, MpCCI::Metrics* pm)
+  {
+    MpCCI::Metrics::Scope timer(pm, MpCCI::Metrics::OUTPUT);
+    if constexpr (modal)
+      if (this->S1.opt.format >= 0 || !this->S1.opt.hdf5.empty())
+        this->S1.setSolution(nSim.getSolution(), 0);
+
+    if (!this->saveState(geoBlk,nBlock))
+      return false;
+
+    if (!checkpointer || this->tp.step % checkpointInterval != 0)
+      return true;
+
+    HDF5Restart::SerializeData data;
+    if (!this->tp.serialize(data) || !nSim.serialize(data) ||
+        !this->S1.serializeCoupling(data))
+      return false;
+
+    // The subcycling history and the time step size received for the
+    // next window, which is pending when the step was corrected
+    std::string str;
+    stepControl.serialize(str);
+    MpCCI::appendVector(str, std::vector<double>{serverDt});
+    data["MpCCI::SIMSolver"] = str;
+
+    std::lock_guard<std::mutex> lock(MpCCI::hdf5Mutex());
+    return checkpointer->writeData(data);
+  }
+
+  //! \brief Restores the time integration state from a coupled checkpoint.
+  //! \param nSim Time integrator
+  //! \param data The checkpoint data, for the coupling state to be restored
+  bool readCheckpoint(Newmark& nSim, HDF5Restart::SerializeData& data)
+  {
+    int level;
+    {
+      std::lock_guard<std::mutex> lock(MpCCI::hdf5Mutex());
+      HDF5Restart reader(checkpointFile, this->S1.getProcessAdm());
+      level = reader.readData(data, restartLevel);
+    }
+
+    if (level < 0 || !this->tp.deSerialize(data) || !nSim.deSerialize(data) ||
+        !this->deSerializeWindow(data)) {
+      IFEM::cout << "  ** Failed to read coupled checkpoint from "
+                 << checkpointFile << std::endl;
+      return false;
+    }
+
+    if constexpr (!modal)
+      this->S1.setSolution(nSim.getSolution(), 0);
+
+    IFEM::cout << "MpCCI: Restarting from checkpoint " << level << " at step "
+               << this->tp.step << ", time " << this->tp.time.t << std::endl;
+    return true;
+  }
+
+  //! \brief Restores the subcycling state and the received time step size.
+  bool deSerializeWindow(const HDF5Restart::SerializeData& data)
+  {
+    const auto it = data.find("MpCCI::SIMSolver");
+    std::vector<double> dt;
+    size_t pos = 0;
+    if (it == data.end() || !stepControl.deSerialize(it->second, pos) ||
+        !MpCCI::extractVector(it->second, pos, dt) || dt.size() != 1)
+      return false;
+
+    serverDt = dt.front();
+    return true;
+  }
+
+  //! \brief Starts the I/O thread writing the MpCCI coupling data.
+  void startDataWriter()
+  {
+    MpCCI::AsyncWriter::Sink sink;
+    if (replayWriter)
+      sink = [w = replayWriter.get()](double t, const std::vector<double>& p)
+      {
+        return w->write(t, p.data(), p.size());
+      };
+    else if (compressedWriter)
+      sink = [w = compressedWriter.get()](double t, const std::vector<double>& p)
+      {
+        return w->write(t, p.data(), p.size());
+      };
+    else if (mpcciSerializer)
+      sink = [this](double t, const std::vector<double>& p)
+      {
+        HDF5Restart::SerializeData data;
+        T1::serializePressures(p, data);
+        MpCCI::setLevelTime(t, data);
+        std::lock_guard<std::mutex> lock(MpCCI::hdf5Mutex());
+        return this->mpcciSerializer->writeData(data);
+      };
+    else
+      return;
+
+    // Parallel HDF5 output is collective, keep it on the main thread
+    const bool threaded = !mpcciSerializer ||
+                          this->S1.getProcessAdm().getNoProcs() == 1;
+    dataWriter = std::make_unique<MpCCI::AsyncWriter>(sink, queueDepth, threaded);
+  }
+
+  //! \brief Starts the I/O thread writing the interface output.
+  //! \details The coupling mesh is written on rank 0, which gathers the state.
+  bool startInterfaceWriter()
+  {
+    const MpCCI::MeshInfo* info = this->S1.getCouplingInfo();
+    if (!info) {
+      IFEM::cout << "  ** Interface output requires a coupling surface."
+                 << std::endl;
+      return false;
+    }
+
+    if (this->S1.getProcessAdm().getProcId() != 0)
+      return true;
+
+    interfaceWriter = std::make_unique<MpCCI::InterfaceWriter>(interfaceFile);
+    if (!interfaceWriter->open(*info)) {
+      IFEM::cout << "  ** Failed to open interface output " << interfaceFile
+                 << std::endl;
+      return false;
+    }
+
+    auto sink = [w = interfaceWriter.get()](double t, const std::vector<double>& s)
+    {
+      return w->write(t, s);
+    };
+    interfaceQueue = std::make_unique<MpCCI::AsyncWriter>(sink, queueDepth, true);
+    return true;
+  }
+
   std::unique_ptr<HDF5Restart> mpcciSerializer; //!< Serializer for MpCCI coupling data
-  std::string couplingSet; //!< Name of set used for coupling, used when running with mocked MpCCI
+  std::unique_ptr<MpCCI::ReplayWriter> replayWriter; //!< Binary writer for MpCCI coupling data
+  //! Compressed writer for MpCCI coupling data
+  std::unique_ptr<MpCCI::CompressedReplayWriter> compressedWriter;
+  //! I/O thread for MpCCI coupling data, destroyed before the writers above
+  std::unique_ptr<MpCCI::AsyncWriter> dataWriter;
+  int queueDepth = 4; //!< Maximum number of queued coupling data snapshots
+  std::vector<std::string> couplingSets; //!< Names of sets used for coupling, used when running with mocked MpCCI
   std::string couplingFile; //!< Name of file used for coupling data
+  bool useMeshCache = false; //!< Cache the coupling mesh next to the input file
+  //! Interpolation in time of recorded coupling data, used when running with mocked MpCCI
+  MpCCI::ReplayResampler::Scheme replayScheme = MpCCI::ReplayResampler::Scheme::Linear;
+  double slabThickness = 0.0; //!< Extrusion thickness of 2D coupling meshes
+  std::unique_ptr<HDF5Restart> checkpointer; //!< Writer for coupled checkpoints
+  std::string checkpointFile; //!< Name of coupled checkpoint file
+  int checkpointInterval = 0; //!< Steps between coupled checkpoints, 0 to disable
+  bool restart = false; //!< Resume from a coupled checkpoint
+  int restartLevel = -1; //!< Checkpoint level to resume from, -1 for the last
+  std::string metricsFile; //!< Name of per-step coupling metrics file
+  std::string interfaceFile; //!< Name of interface output file, empty to disable
+  int volumeInterval = 1; //!< Steps between volume output with interface output
+  std::unique_ptr<MpCCI::InterfaceWriter> interfaceWriter; //!< Interface output writer
+  //! I/O thread for interface output, destroyed before the writer above
+  std::unique_ptr<MpCCI::AsyncWriter> interfaceQueue;
+  std::vector<double> interfaceState; //!< Buffer for the interface state
+  MpCCI::StepControl stepControl; //!< Structural subcycling control
+  double serverDt = 0.0; //!< Time step size received from the server
 };
 
 }